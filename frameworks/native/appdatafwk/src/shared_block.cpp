@@ -19,8 +19,11 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <codecvt>
 #include <iostream>
+#include <map>
+#include <mutex>
 
 #include "string_ex.h"
 #include "logger.h"
@@ -28,7 +31,8 @@
 namespace OHOS {
 namespace AppDataFwk {
 SharedBlock::SharedBlock(const std::string &name, sptr<Ashmem> ashmem, size_t size, bool readOnly)
-    : mName(name), ashmem_(ashmem), mSize(size), mReadOnly(readOnly), mHeader(nullptr)
+    : mName(name), ashmem_(ashmem), mSize(size), mReadOnly(readOnly), mPooled(false), mShared(false),
+      mHeader(nullptr), mGeneration(-1)
 {
 }
 
@@ -106,8 +110,120 @@ int SharedBlock::Create(const std::string &name, size_t size, SharedBlock *&outS
     return result;
 }
 
+namespace {
+// The pool rounds sizes up to powers of two from this one
+constexpr size_t MIN_POOLED_SIZE = 64 * 1024;
+constexpr size_t DEFAULT_POOL_CAPACITY = 8 * 1024 * 1024;
+
+struct SharedBlockPool {
+    std::mutex mutex;
+    std::map<size_t, std::vector<SharedBlock *>> idleBlocks;
+    size_t capacity = DEFAULT_POOL_CAPACITY;
+    SharedBlock::PoolStats stats {};
+};
+
+// never destroyed, blocks may still be released by the destructors of other static objects at exit
+SharedBlockPool &GetPool()
+{
+    static SharedBlockPool *pool = new SharedBlockPool();
+    return *pool;
+}
+} // namespace
+
+int SharedBlock::Lease(const std::string &name, size_t size, SharedBlock *&outSharedBlock)
+{
+    size_t sizeClass = MIN_POOLED_SIZE;
+    while (sizeClass < size) {
+        sizeClass <<= 1;
+    }
+
+    SharedBlockPool &pool = GetPool();
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        auto &blocks = pool.idleBlocks[sizeClass];
+        if (!blocks.empty()) {
+            outSharedBlock = blocks.back();
+            blocks.pop_back();
+            pool.stats.idleBytes -= sizeClass;
+            pool.stats.reuseCount++;
+            outSharedBlock->mName = name;
+            return SHARED_BLOCK_OK;
+        }
+    }
+
+    int result = Create(name, sizeClass, outSharedBlock);
+    if (result != SHARED_BLOCK_OK) {
+        return result;
+    }
+    outSharedBlock->mPooled = true;
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.stats.createCount++;
+    return SHARED_BLOCK_OK;
+}
+
+void SharedBlock::Release(SharedBlock *block)
+{
+    if (block == nullptr) {
+        return;
+    }
+    if (!block->mPooled || block->mShared || block->mHeader == nullptr) {
+        delete block;
+        return;
+    }
+
+    // the next lease may send the block to another process, which must not see the rows of this one
+    size_t usedBytes = std::min(static_cast<size_t>(block->mHeader->unusedOffset), block->mSize);
+    if (memset_s(block->mData, block->mSize, 0, usedBytes) != EOK) {
+        delete block;
+        return;
+    }
+    block->mColumnarColumns.clear();
+    block->mGroupOffsets.clear();
+    block->mGeneration = -1;
+
+    SharedBlockPool &pool = GetPool();
+    std::unique_lock<std::mutex> lock(pool.mutex);
+    if (pool.stats.idleBytes + block->mSize > pool.capacity) {
+        pool.stats.dropCount++;
+        lock.unlock();
+        delete block;
+        return;
+    }
+    pool.idleBlocks[block->mSize].push_back(block);
+    pool.stats.idleBytes += block->mSize;
+}
+
+void SharedBlock::SetPoolCapacity(size_t capacity)
+{
+    std::vector<SharedBlock *> dropped;
+    SharedBlockPool &pool = GetPool();
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.capacity = capacity;
+        for (auto &[size, blocks] : pool.idleBlocks) {
+            while (pool.stats.idleBytes > capacity && !blocks.empty()) {
+                dropped.push_back(blocks.back());
+                blocks.pop_back();
+                pool.stats.idleBytes -= size;
+                pool.stats.dropCount++;
+            }
+        }
+    }
+    for (SharedBlock *block : dropped) {
+        delete block;
+    }
+}
+
+SharedBlock::PoolStats SharedBlock::GetPoolStats()
+{
+    SharedBlockPool &pool = GetPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return pool.stats;
+}
+
 int SharedBlock::WriteMessageParcel(MessageParcel &parcel)
 {
+    mShared = true;
     return parcel.WriteString16(ToUtf16(mName)) && parcel.WriteAshmem(ashmem_);
 }
 
@@ -150,11 +266,24 @@ int SharedBlock::Clear()
         return SHARED_BLOCK_INVALID_OPERATION;
     }
 
-    mHeader->unusedOffset = sizeof(SharedBlockHeader) + sizeof(RowGroupHeader);
-    mHeader->firstRowGroupOffset = sizeof(SharedBlockHeader);
+    mHeader->firstRowGroupOffset = sizeof(SharedBlockHeader) + sizeof(SharedBlockHeaderExt);
+    mHeader->unusedOffset = mHeader->firstRowGroupOffset + sizeof(RowGroupHeader);
     mHeader->rowNums = 0;
     mHeader->columnNums = 0;
 
+    SharedBlockHeaderExt *ext = GetHeaderExt();
+    if (ext == nullptr) {
+        LOG_ERROR("Failed to get header ext in clear().");
+        return SHARED_BLOCK_BAD_VALUE;
+    }
+    ext->generation++;
+    ext->columnarNum = 0;
+    ext->columnarDirOffset = 0;
+    ext->columnarCapacity = 0;
+    ext->startPos = 0;
+    mGroupOffsets.clear();
+    mGeneration = ext->generation;
+
     RowGroupHeader *firstGroup = static_cast<RowGroupHeader *>(OffsetToPtr(mHeader->firstRowGroupOffset));
     if (!firstGroup) {
         LOG_ERROR("Failed to get group in clear().");
@@ -180,15 +309,145 @@ int SharedBlock::SetColumnNum(uint32_t numColumns)
         return SHARED_BLOCK_INVALID_OPERATION;
     }
     mHeader->columnNums = numColumns;
+    if (!mColumnarColumns.empty() && mHeader->rowNums == 0) {
+        AllocColumnar();
+    }
     return SHARED_BLOCK_OK;
 }
 
+void SharedBlock::SetColumnarColumns(const std::vector<uint32_t> &columns)
+{
+    mColumnarColumns = columns;
+}
+
+/**
+ * Reserves the column-major arrays of the requested columns. Every row takes at least its cell units and its row
+ * offset, so the arrays get room for as many rows as the rest of the block can hold. The block stays row-major
+ * only if there is no room.
+ */
+void SharedBlock::AllocColumnar()
+{
+    SharedBlockHeaderExt *ext = GetHeaderExt();
+    if (ext == nullptr || ext->columnarNum != 0) {
+        return;
+    }
+
+    std::vector<uint32_t> columns;
+    for (uint32_t column : mColumnarColumns) {
+        if (column < mHeader->columnNums) {
+            columns.push_back(column);
+        }
+    }
+    if (columns.empty()) {
+        return;
+    }
+
+    const uint32_t alignMask = sizeof(int64_t) - 1;
+    size_t dirSize = columns.size() * sizeof(ColumnarDir);
+    size_t overhead = dirSize + columns.size() * (alignMask + sizeof(uint32_t));
+    size_t freeSize = mSize - mHeader->unusedOffset;
+    size_t rowSize = mHeader->columnNums * sizeof(CellUnit) + sizeof(uint32_t) +
+        columns.size() * (sizeof(int64_t) + sizeof(uint8_t));
+    if (freeSize <= overhead || (freeSize - overhead) / rowSize == 0) {
+        LOG_INFO("No room for %{public}zu columnar columns, the block stays row-major.", columns.size());
+        return;
+    }
+    uint32_t capacity = static_cast<uint32_t>((freeSize - overhead) / rowSize);
+
+    uint32_t unusedOffset = mHeader->unusedOffset;
+    uint32_t dirOffset = Alloc(dirSize, true);
+    ColumnarDir *dirs = dirOffset ? static_cast<ColumnarDir *>(OffsetToPtr(dirOffset, dirSize)) : nullptr;
+    if (dirs == nullptr) {
+        mHeader->unusedOffset = unusedOffset;
+        return;
+    }
+    for (size_t i = 0; i < columns.size(); i++) {
+        uint32_t valuesOffset = Alloc(capacity * sizeof(int64_t) + alignMask, true);
+        uint32_t typesOffset = Alloc(capacity);
+        if (!valuesOffset || !typesOffset) {
+            mHeader->unusedOffset = unusedOffset;
+            return;
+        }
+        dirs[i].column = columns[i];
+        dirs[i].valuesOffset = (valuesOffset + alignMask) & ~alignMask;
+        dirs[i].typesOffset = typesOffset;
+    }
+    ext->columnarDirOffset = dirOffset;
+    ext->columnarCapacity = capacity;
+    ext->columnarNum = static_cast<uint32_t>(columns.size());
+}
+
+void SharedBlock::PutColumnar(uint32_t row, uint32_t column, int32_t type, const void *value)
+{
+    SharedBlockHeaderExt *ext = GetHeaderExt();
+    if (ext == nullptr || ext->columnarNum == 0 || row >= ext->columnarCapacity) {
+        return;
+    }
+    auto *dirs = static_cast<ColumnarDir *>(
+        OffsetToPtr(ext->columnarDirOffset, ext->columnarNum * sizeof(ColumnarDir)));
+    if (dirs == nullptr) {
+        return;
+    }
+    for (uint32_t i = 0; i < ext->columnarNum; i++) {
+        if (dirs[i].column != column) {
+            continue;
+        }
+        auto *types = static_cast<uint8_t *>(OffsetToPtr(dirs[i].typesOffset, ext->columnarCapacity));
+        auto *values = static_cast<uint8_t *>(
+            OffsetToPtr(dirs[i].valuesOffset, ext->columnarCapacity * sizeof(int64_t)));
+        if (types == nullptr || values == nullptr) {
+            return;
+        }
+        types[row] = static_cast<uint8_t>(type);
+        if (value != nullptr) {
+            memcpy_s(values + row * sizeof(int64_t), sizeof(int64_t), value, sizeof(int64_t));
+        }
+        return;
+    }
+}
+
+bool SharedBlock::GetColumnView(uint32_t column, ColumnView &view)
+{
+    SharedBlockHeaderExt *ext = GetHeaderExt();
+    if (ext == nullptr || ext->columnarNum == 0 || mHeader->rowNums > ext->columnarCapacity) {
+        return false;
+    }
+    auto *dirs = static_cast<ColumnarDir *>(
+        OffsetToPtr(ext->columnarDirOffset, ext->columnarNum * sizeof(ColumnarDir)));
+    if (dirs == nullptr) {
+        return false;
+    }
+    for (uint32_t i = 0; i < ext->columnarNum; i++) {
+        if (dirs[i].column != column) {
+            continue;
+        }
+        auto *types = static_cast<const uint8_t *>(OffsetToPtr(dirs[i].typesOffset, ext->columnarCapacity));
+        auto *values = OffsetToPtr(dirs[i].valuesOffset, ext->columnarCapacity * sizeof(int64_t));
+        if (types == nullptr || values == nullptr) {
+            return false;
+        }
+        view.types = types;
+        view.longs = static_cast<const int64_t *>(values);
+        view.doubles = static_cast<const double *>(values);
+        view.rowNum = mHeader->rowNums;
+        return true;
+    }
+    return false;
+}
+
 int SharedBlock::AllocRow()
 {
     if (mReadOnly) {
         return SHARED_BLOCK_INVALID_OPERATION;
     }
 
+    if (!mColumnarColumns.empty()) {
+        SharedBlockHeaderExt *ext = GetHeaderExt();
+        if (ext != nullptr && ext->columnarNum != 0 && mHeader->rowNums >= ext->columnarCapacity) {
+            return SHARED_BLOCK_NO_MEMORY;
+        }
+    }
+
     /* Fill in the row offset */
     uint32_t *rowOffset = AllocRowOffset();
     if (rowOffset == nullptr) {
@@ -253,61 +512,119 @@ uint32_t SharedBlock::Alloc(size_t size, bool aligned)
     return offset;
 }
 
-uint32_t *SharedBlock::GetRowOffset(uint32_t row)
+SharedBlock::SharedBlockHeaderExt *SharedBlock::GetHeaderExt()
 {
-    uint32_t rowPos = row;
-
-    RowGroupHeader *group = static_cast<RowGroupHeader *>(OffsetToPtr(mHeader->firstRowGroupOffset));
-    if (group == nullptr) {
-        LOG_ERROR("Failed to get group in getRowOffset().");
+    if (mHeader->firstRowGroupOffset < sizeof(SharedBlockHeader) + sizeof(SharedBlockHeaderExt)) {
         return nullptr;
     }
+    return static_cast<SharedBlockHeaderExt *>(OffsetToPtr(sizeof(SharedBlockHeader), sizeof(SharedBlockHeaderExt)));
+}
 
-    while (rowPos >= ROW_OFFSETS_NUM) {
-        group = static_cast<RowGroupHeader *>(OffsetToPtr(group->nextGroupOffset));
-        if (group == nullptr) {
-            LOG_ERROR("Failed to get group in OffsetToPtr(group->nextGroupOffset) when while loop.");
-            return nullptr;
-        }
-        rowPos -= ROW_OFFSETS_NUM;
+size_t SharedBlock::GetColumnarBytes()
+{
+    SharedBlockHeaderExt *ext = GetHeaderExt();
+    if (ext == nullptr || ext->columnarNum == 0) {
+        return 0;
+    }
+    auto *dirs = static_cast<ColumnarDir *>(
+        OffsetToPtr(ext->columnarDirOffset, ext->columnarNum * sizeof(ColumnarDir)));
+    if (dirs == nullptr) {
+        return 0;
     }
+    // the directory and the arrays are allocated in one run, ending with the types of the last column
+    return dirs[ext->columnarNum - 1].typesOffset + ext->columnarCapacity - ext->columnarDirOffset;
+}
 
-    return &group->rowOffsets[rowPos];
+uint32_t SharedBlock::GetStartPos()
+{
+    SharedBlockHeaderExt *ext = GetHeaderExt();
+    return (ext == nullptr) ? 0 : ext->startPos;
 }
 
-uint32_t *SharedBlock::AllocRowOffset()
+void SharedBlock::SetStartPos(uint32_t startPos)
+{
+    SharedBlockHeaderExt *ext = GetHeaderExt();
+    if (ext != nullptr) {
+        ext->startPos = startPos;
+    }
+}
+
+/**
+ * Gets the row group at index, following the chain only past the groups found before. The groups found are
+ * forgotten when the block was cleared since, and on every call for blocks written by older peers.
+ */
+SharedBlock::RowGroupHeader *SharedBlock::GetRowGroup(uint32_t index)
 {
-    uint32_t rowPos = mHeader->rowNums;
+    SharedBlockHeaderExt *ext = GetHeaderExt();
+    int64_t generation = (ext == nullptr) ? -1 : static_cast<int64_t>(ext->generation);
+    if (generation < 0 || generation != mGeneration) {
+        mGroupOffsets.clear();
+        mGeneration = generation;
+    }
+    if (mGroupOffsets.empty()) {
+        mGroupOffsets.push_back(mHeader->firstRowGroupOffset);
+    }
 
-    RowGroupHeader *group = static_cast<RowGroupHeader *>(OffsetToPtr(mHeader->firstRowGroupOffset));
+    while (mGroupOffsets.size() <= index) {
+        RowGroupHeader *group =
+            static_cast<RowGroupHeader *>(OffsetToPtr(mGroupOffsets.back(), sizeof(RowGroupHeader)));
+        if (group == nullptr || group->nextGroupOffset == 0) {
+            LOG_ERROR("Failed to get group %{public}" PRIu32 " of %{public}zu groups.", index, mGroupOffsets.size());
+            return nullptr;
+        }
+        mGroupOffsets.push_back(group->nextGroupOffset);
+    }
+    return static_cast<RowGroupHeader *>(OffsetToPtr(mGroupOffsets[index], sizeof(RowGroupHeader)));
+}
+
+uint32_t *SharedBlock::GetRowOffset(uint32_t row)
+{
+    RowGroupHeader *group = GetRowGroup(row / ROW_OFFSETS_NUM);
     if (group == nullptr) {
-        LOG_ERROR("Failed to get group in allocRowOffset().");
+        LOG_ERROR("Failed to get group in getRowOffset().");
         return nullptr;
     }
+    return &group->rowOffsets[row % ROW_OFFSETS_NUM];
+}
 
-    while (rowPos > ROW_OFFSETS_NUM) {
-        group = static_cast<RowGroupHeader *>(OffsetToPtr(group->nextGroupOffset));
-        if (group == nullptr) {
-            LOG_ERROR("Failed to get group in OffsetToPtr(group->nextGroupOffset) when while loop.");
+uint32_t *SharedBlock::AllocRowOffset()
+{
+    uint32_t index = mHeader->rowNums / ROW_OFFSETS_NUM;
+    uint32_t rowPos = mHeader->rowNums % ROW_OFFSETS_NUM;
+    RowGroupHeader *group = nullptr;
+    if (index > 0 && rowPos == 0) {
+        RowGroupHeader *prevGroup = GetRowGroup(index - 1);
+        if (prevGroup == nullptr) {
+            LOG_ERROR("Failed to get group in allocRowOffset().");
             return nullptr;
         }
-        rowPos -= ROW_OFFSETS_NUM;
-    }
-    if (rowPos == ROW_OFFSETS_NUM) {
-        if (!group->nextGroupOffset) {
+        bool allocated = false;
+        if (!prevGroup->nextGroupOffset) {
             /* Aligned */
-            group->nextGroupOffset = Alloc(sizeof(RowGroupHeader), true);
-            if (!group->nextGroupOffset) {
+            prevGroup->nextGroupOffset = Alloc(sizeof(RowGroupHeader), true);
+            if (!prevGroup->nextGroupOffset) {
                 return nullptr;
             }
+            allocated = true;
         }
-        group = static_cast<RowGroupHeader *>(OffsetToPtr(group->nextGroupOffset));
+        group = static_cast<RowGroupHeader *>(OffsetToPtr(prevGroup->nextGroupOffset, sizeof(RowGroupHeader)));
         if (group == nullptr) {
             LOG_ERROR("Failed to get group in OffsetToPtr(group->nextGroupOffset).");
             return nullptr;
         }
-        group->nextGroupOffset = 0;
-        rowPos = 0;
+        /* A group left by freed rows keeps its successors, so the offsets readers cached stay valid until Clear */
+        if (allocated) {
+            group->nextGroupOffset = 0;
+        }
+        if (mGroupOffsets.size() <= index) {
+            mGroupOffsets.push_back(prevGroup->nextGroupOffset);
+        }
+    } else {
+        group = GetRowGroup(index);
+        if (group == nullptr) {
+            LOG_ERROR("Failed to get group in allocRowOffset().");
+            return nullptr;
+        }
     }
 
     mHeader->rowNums += 1;
@@ -379,6 +696,9 @@ int SharedBlock::PutBlobOrString(uint32_t row, uint32_t column, const void *valu
     cellUnit->type = type;
     cellUnit->cell.stringOrBlobValue.offset = offset;
     cellUnit->cell.stringOrBlobValue.size = size;
+    if (!mColumnarColumns.empty()) {
+        PutColumnar(row, column, type, nullptr);
+    }
     return SHARED_BLOCK_OK;
 }
 
@@ -395,6 +715,9 @@ int SharedBlock::PutLong(uint32_t row, uint32_t column, int64_t value)
 
     cellUnit->type = CELL_UNIT_TYPE_INTEGER;
     cellUnit->cell.longValue = value;
+    if (!mColumnarColumns.empty()) {
+        PutColumnar(row, column, CELL_UNIT_TYPE_INTEGER, &value);
+    }
     return SHARED_BLOCK_OK;
 }
 
@@ -411,6 +734,9 @@ int SharedBlock::PutDouble(uint32_t row, uint32_t column, double value)
 
     cellUnit->type = CELL_UNIT_TYPE_FLOAT;
     cellUnit->cell.doubleValue = value;
+    if (!mColumnarColumns.empty()) {
+        PutColumnar(row, column, CELL_UNIT_TYPE_FLOAT, &value);
+    }
     return SHARED_BLOCK_OK;
 }
 
@@ -428,6 +754,9 @@ int SharedBlock::PutNull(uint32_t row, uint32_t column)
     cellUnit->type = CELL_UNIT_TYPE_NULL;
     cellUnit->cell.stringOrBlobValue.offset = 0;
     cellUnit->cell.stringOrBlobValue.size = 0;
+    if (!mColumnarColumns.empty()) {
+        PutColumnar(row, column, CELL_UNIT_TYPE_NULL, nullptr);
+    }
     return SHARED_BLOCK_OK;
 }
 
@@ -446,6 +775,8 @@ size_t SharedBlock::SetRawData(const void *rawData, size_t size)
     if (result != 0) {
         return SHARED_BLOCK_NO_MEMORY;
     }
+    mGroupOffsets.clear();
+    mGeneration = -1;
     return SHARED_BLOCK_OK;
 }
 
@@ -25,6 +25,7 @@ DataShareBlockWriterImpl::DataShareBlockWriterImpl() : shareBlock_(nullptr)
 DataShareBlockWriterImpl::DataShareBlockWriterImpl(const std::string &name, size_t size)
     : shareBlock_(nullptr)
 {
+    // the block is always sent to the consumer, which may still map it, so it could not go back to the pool
     AppDataFwk::SharedBlock::Create(name, size, shareBlock_);
 }
 
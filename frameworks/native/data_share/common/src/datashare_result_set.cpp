@@ -359,7 +359,7 @@ bool DataShareResultSet::HasBlock() const
  */
 void DataShareResultSet::ClosedBlock()
 {
-    delete sharedBlock_;
+    AppDataFwk::SharedBlock::Release(sharedBlock_);
     sharedBlock_ = nullptr;
 }
 
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NATIVE_RDB_GROUP_COMMIT_QUEUE_H
+#define NATIVE_RDB_GROUP_COMMIT_QUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "value_object.h"
+
+namespace OHOS {
+namespace NativeRdb {
+
+/**
+ * Collects the single statement writes of many threads, the first waiting thread executes the queued writes
+ * in one transaction on behalf of the others.
+ */
+class GroupCommitQueue {
+public:
+    struct WriteRequest {
+        bool isInsert;
+        const std::string *sql;
+        const std::vector<ValueObject> *bindArgs;
+        int64_t result; // the row id for inserts, the number of changed rows otherwise
+        int errCode;
+        bool done;
+    };
+    using Executor = std::function<void(std::vector<WriteRequest *> &batch)>;
+
+    GroupCommitQueue(std::chrono::milliseconds window, Executor executor);
+    ~GroupCommitQueue() = default;
+    int Submit(bool isInsert, int64_t &result, const std::string &sql, const std::vector<ValueObject> &bindArgs);
+
+private:
+    static constexpr size_t MAX_BATCH_SIZE = 128;
+
+    std::chrono::milliseconds window;
+    Executor executor;
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<WriteRequest *> pendingRequests;
+    bool hasLeader;
+    size_t lastBatchSize;
+};
+
+} // namespace NativeRdb
+} // namespace OHOS
+#endif
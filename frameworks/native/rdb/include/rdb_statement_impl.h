@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NATIVE_RDB_RDB_STATEMENT_IMPL_H
+#define NATIVE_RDB_RDB_STATEMENT_IMPL_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rdb_statement.h"
+#include "rdb_store_impl.h"
+#include "sqlite_connection.h"
+
+namespace OHOS {
+namespace NativeRdb {
+class RdbStatementImpl : public RdbStatement {
+public:
+    RdbStatementImpl(std::shared_ptr<RdbStoreImpl> rdb, std::shared_ptr<const PinnedSql> pinnedSql);
+    ~RdbStatementImpl() override;
+
+    int Bind(int index, const ValueObject &value) override;
+    int BindArgs(const std::vector<ValueObject> &bindArgs) override;
+    void ClearBindings() override;
+    int Execute() override;
+    int ExecuteForLastInsertedRowId(int64_t &outRowId) override;
+    int ExecuteForChangedRowCount(int64_t &outValue) override;
+    int ExecuteGetLong(int64_t &outValue) override;
+    std::unique_ptr<AbsSharedResultSet> Query() override;
+    std::string GetSql() const override;
+    int GetParameterCount() const override;
+    bool IsReadOnly() const override;
+
+private:
+    std::shared_ptr<RdbStoreImpl> rdb;
+    std::shared_ptr<const PinnedSql> pinnedSql;
+    std::vector<ValueObject> bindArgs;
+};
+} // namespace NativeRdb
+} // namespace OHOS
+
+#endif
@@ -16,12 +16,15 @@
 #ifndef NATIVE_RDB_RDB_STORE_IMPL_H
 #define NATIVE_RDB_RDB_STORE_IMPL_H
 
+#include <atomic>
 #include <list>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
 
+#include "group_commit_queue.h"
 #include "rdb_store.h"
 #include "rdb_store_config.h"
 #include "sqlite_connection_pool.h"
@@ -40,6 +43,12 @@ public:
     int Replace(int64_t &outRowId, const std::string &table, const ValuesBucket &initialValues) override;
     int InsertWithConflictResolution(int64_t &outRowId, const std::string &table, const ValuesBucket &initialValues,
         ConflictResolution conflictResolution) override;
+    int BatchInsert(int64_t &outInsertNum, const std::string &table,
+        const std::vector<ValuesBucket> &values) override;
+    int Upsert(int64_t &outChangedRows, const std::string &table, const ValuesBucket &values,
+        const std::vector<std::string> &conflictColumns, const std::vector<std::string> &updateColumns) override;
+    int BatchUpsert(int64_t &outChangedRows, const std::string &table, const std::vector<ValuesBucket> &values,
+        const std::vector<std::string> &conflictColumns, const std::vector<std::string> &updateColumns) override;
     int Update(int &changedRows, const std::string &table, const ValuesBucket &values, const std::string &whereClause,
         const std::vector<std::string> &whereArgs) override;
     int UpdateWithConflictResolution(int &changedRows, const std::string &table, const ValuesBucket &values,
@@ -47,12 +56,21 @@ public:
         ConflictResolution conflictResolution) override;
     int Delete(int &deletedRows, const std::string &table, const std::string &whereClause,
         const std::vector<std::string> &whereArgs) override;
+    int Update(int &changedRows, const std::string &table, const ValuesBucket &values, const std::string &whereClause,
+        const std::vector<ValueObject> &bindArgs) override;
+    int UpdateWithConflictResolution(int &changedRows, const std::string &table, const ValuesBucket &values,
+        const std::string &whereClause, const std::vector<ValueObject> &bindArgs,
+        ConflictResolution conflictResolution) override;
+    int Delete(int &deletedRows, const std::string &table, const std::string &whereClause,
+        const std::vector<ValueObject> &bindArgs) override;
     std::unique_ptr<AbsSharedResultSet> Query(int &errCode, bool distinct,
         const std::string &table, const std::vector<std::string> &columns,
         const std::string &selection, const std::vector<std::string> &selectionArgs, const std::string &groupBy,
         const std::string &having, const std::string &orderBy, const std::string &limit) override;
     std::unique_ptr<AbsSharedResultSet> QuerySql(const std::string &sql,
         const std::vector<std::string> &selectionArgs) override;
+    std::unique_ptr<AbsSharedResultSet> QuerySql(const std::string &sql,
+        const std::vector<ValueObject> &bindArgs) override;
     int ExecuteSql(const std::string &sql, const std::vector<ValueObject> &bindArgs) override;
     int ExecuteAndGetLong(int64_t &outValue, const std::string &sql, const std::vector<ValueObject> &bindArgs) override;
     int ExecuteAndGetString(std::string &outValue, const std::string &sql,
@@ -61,6 +79,9 @@ public:
         const std::vector<ValueObject> &bindArgs) override;
     int ExecuteForChangedRowCount(int64_t &outValue, const std::string &sql,
         const std::vector<ValueObject> &bindArgs) override;
+    std::shared_ptr<RdbStatement> Prepare(int &errCode, const std::string &sql) override;
+    int ExecutePinned(const std::shared_ptr<const PinnedSql> &pinnedSql, const std::vector<ValueObject> &bindArgs,
+        PinnedSql::ResultType resultType, int64_t &outValue);
     int Backup(const std::string databasePath, const std::vector<uint8_t> destEncryptKey) override;
     int Attach(const std::string &alias, const std::string &pathName,
         const std::vector<uint8_t> destEncryptKey) override;
@@ -74,7 +95,7 @@ public:
     bool IsInTransaction() override;
     int ChangeEncryptKey(const std::vector<uint8_t> &newKey) override;
     std::shared_ptr<SqliteStatement> BeginStepQuery(int &errCode, const std::string sql,
-        const std::vector<std::string> &bindArgs);
+        const std::vector<ValueObject> &bindArgs);
     int EndStepQuery();
     bool IsOpen() const override;
     std::string GetPath() override;
@@ -94,16 +115,28 @@ public:
     std::string GetOrgPath();
     std::string GetFileType();
     std::string GetFileSecurityLevel();
+    void GetStatementCacheStats(uint64_t &hits, uint64_t &misses);
+    void GetReadConnectionCount(int &total, int &idle);
+    int GetIdleSessionCount() const;
+    bool ReservePrefetchConnection();
+    void ReleasePrefetchConnection();
+    void GetConnectionPoolStats(ConnectionPoolStats &writeStats, ConnectionPoolStats &readStats);
+    void GetCheckpointStats(CheckpointStats &stats);
     int ExecuteForSharedBlock(int &rowNum, AppDataFwk::SharedBlock *sharedBlock, int startPos, int requiredPos,
         bool isCountAllRows, std::string sql, std::vector<ValueObject> &bindArgVec);
     std::unique_ptr<ResultSet> QueryByStep(const std::string &sql,
         const std::vector<std::string> &selectionArgs) override;
+    std::unique_ptr<ResultSet> QueryByStep(const std::string &sql,
+        const std::vector<ValueObject> &bindArgs) override;
 
     std::unique_ptr<AbsSharedResultSet> Query(const AbsRdbPredicates &predicates,
         const std::vector<std::string> columns) override;
     int Count(int64_t &outValue, const AbsRdbPredicates &predicates) override;
     int Update(int &changedRows, const ValuesBucket &values, const AbsRdbPredicates &predicates) override;
     int Delete(int &deletedRows, const AbsRdbPredicates &predicates) override;
+    int BatchUpdate(std::vector<int64_t> &changedRows,
+        const std::vector<std::pair<ValuesBucket, AbsRdbPredicates>> &updates) override;
+    int BatchDelete(std::vector<int64_t> &deletedRows, const std::vector<AbsRdbPredicates> &predicates) override;
 
     bool SetDistributedTables(const std::vector<std::string>& tables) override;
 
@@ -123,12 +156,35 @@ private:
     std::shared_ptr<StoreSession> GetThreadSession();
     void ReleaseThreadSession();
     int CheckAttach(const std::string &sql);
+    int ExecuteWrite(bool isInsert, int64_t &result, const std::string &sql, const std::vector<ValueObject> &bindArgs,
+        ConflictResolution conflictResolution);
+    std::shared_ptr<const std::string> GetWriteSql(bool isInsert, const std::string &table,
+        const std::string &conflictClause, const ValuesBucket &values, std::vector<ValueObject> &bindArgs);
+    std::shared_ptr<const std::string> GetUpsertSql(const std::string &table, const ValuesBucket &values,
+        const std::vector<std::string> &conflictColumns, const std::vector<std::string> &updateColumns,
+        std::vector<ValueObject> &bindArgs);
+    std::shared_ptr<const std::string> FindWriteSql(const std::string &key);
+    std::shared_ptr<const std::string> CacheWriteSql(std::string key, std::string sql);
+
+    // the sessions are sharded by thread id so that threads working concurrently rarely share a mutex
+    struct SessionShard {
+        std::mutex mutex;
+        std::map<std::thread::id, std::pair<std::shared_ptr<StoreSession>, int>> threadMap;
+        std::list<std::shared_ptr<StoreSession>> idleSessions;
+    };
+    SessionShard &GetSessionShard(std::thread::id tid);
 
     SqliteConnectionPool *connectionPool;
     static const int MAX_IDLE_SESSION_SIZE = 5;
-    std::mutex sessionMutex;
-    std::map<std::thread::id, std::pair<std::shared_ptr<StoreSession>, int>> threadMap;
-    std::list<std::shared_ptr<StoreSession>> idleSessions;
+    static const int SESSION_SHARD_COUNT = 16;
+    SessionShard sessionShards[SESSION_SHARD_COUNT];
+    // idle sessions of all shards, kept below MAX_IDLE_SESSION_SIZE
+    std::atomic<int> idleSessionCount{0};
+    std::unique_ptr<GroupCommitQueue> groupCommitQueue;
+    // INSERT, UPDATE ... SET and upsert sql keyed by the kind of write, conflict clause, table and column set
+    std::mutex writeSqlMutex;
+    std::unordered_map<std::string, std::shared_ptr<const std::string>> writeSqls;
+    static const size_t MAX_WRITE_SQL_COUNT = 256;
     bool isOpen;
     std::string path;
     std::string orgPath;
@@ -102,6 +102,7 @@ FillOneRowResult FillOneRow(AppDataFwk::SharedBlock *sharedBlock, sqlite3_stmt *
     int startPos, int addedRows);
 void FillRow(SharedBlockInfo *info);
 void FillSharedBlock(SharedBlockInfo *info);
+void FillSharedBlockStep(SharedBlockInfo *info, bool hasRow);
 bool ResetStatement(SharedBlockInfo *sharedBlockInfo);
 int64_t GetCombinedData(int startPos, int totalRows);
 #ifdef __cplusplus
@@ -34,6 +34,15 @@ public:
     std::string GetJournalMode() const;
     std::string GetSyncMode() const;
     std::string GetDatabaseFileType() const;
+    int GetStatementCacheSize() const;
+    int GetMinReadConnectionCount() const;
+    int GetMaxReadConnectionCount() const;
+    int GetReadConnectionIdleTimeout() const;
+    int GetConnectionAcquireTimeout() const;
+    CheckpointPolicy GetCheckpointPolicy() const;
+    int GetCheckpointWalPages() const;
+    int GetCheckpointIdleTime() const;
+    const SqliteTuning &GetTuning(bool isWriteConnection) const;
     bool IsReadOnly() const;
     bool IsEncrypted() const;
     bool IsInitEncrypted() const;
@@ -42,6 +51,8 @@ public:
     void ClearEncryptKey();
 
 private:
+    static SqliteTuning ResolveTuning(const SqliteTuning &tuning, bool isWriteConnection);
+
     std::string path;
     StorageMode storageMode;
     std::string journalMode;
@@ -51,6 +62,16 @@ private:
     bool initEncrypted;
     std::string databaseFileType;
     std::vector<uint8_t> encryptKey;
+    int statementCacheSize;
+    int minReadConnectionCount;
+    int maxReadConnectionCount;
+    int readConnectionIdleTimeout;
+    int connectionAcquireTimeout;
+    CheckpointPolicy checkpointPolicy;
+    int checkpointWalPages;
+    int checkpointIdleTime;
+    SqliteTuning writeTuning;
+    SqliteTuning readTuning;
 };
 
 } // namespace NativeRdb
@@ -16,8 +16,12 @@
 #ifndef NATIVE_RDB_SQLITE_CONNECTION_H
 #define NATIVE_RDB_SQLITE_CONNECTION_H
 
+#include <atomic>
+#include <list>
 #include <mutex>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "sqlite3sym.h"
@@ -29,11 +33,35 @@
 namespace OHOS {
 namespace NativeRdb {
 
+struct StatementCacheStats {
+    std::atomic<uint64_t> hits { 0 };
+    std::atomic<uint64_t> misses { 0 };
+};
+
+/**
+ * A sql prepared through RdbStore::Prepare. It is classified once, and each connection that runs it keeps its
+ * statement outside of the LRU statement cache for as long as an owner holds this object.
+ */
+struct PinnedSql {
+    enum ResultType {
+        NONE,
+        LAST_INSERTED_ROW_ID,
+        CHANGED_ROW_COUNT,
+        LONG_VALUE,
+    };
+    std::string sql;
+    int type = 0; // one of the statement types of SqliteUtils
+    bool isReadOnly = false;
+    int numParameters = 0;
+};
+
 class SqliteConnection {
 public:
-    static SqliteConnection *Open(const SqliteConfig &config, bool isWriteConnection, int &errCode);
+    static SqliteConnection *Open(const SqliteConfig &config, bool isWriteConnection, int &errCode,
+        StatementCacheStats *cacheStats = nullptr);
     ~SqliteConnection();
     bool IsWriteConnection() const;
+    bool IsInTransaction() const;
     int Prepare(const std::string &sql, bool &outIsReadOnly);
     int PrepareAndGetInfo(const std::string &sql, bool &outIsReadOnly, int &numParameters,
         std::vector<std::string> &columnNames);
@@ -45,8 +73,12 @@ public:
         const std::vector<ValueObject> &bindArgs = std::vector<ValueObject>());
     int ExecuteGetString(std::string &outValue, const std::string &sql,
         const std::vector<ValueObject> &bindArgs = std::vector<ValueObject>());
+    int ExecuteBatch(int64_t &outChangedRows, const std::string &sql,
+        const std::vector<std::vector<ValueObject>> &bindArgsList, std::vector<int64_t> *rowChanges = nullptr);
+    int ExecutePinned(const std::shared_ptr<const PinnedSql> &pinnedSql, const std::vector<ValueObject> &bindArgs,
+        PinnedSql::ResultType resultType, int64_t &outValue);
     std::shared_ptr<SqliteStatement> BeginStepQuery(int &errCode, const std::string &sql,
-        const std::vector<std::string> &selectionArgs) const;
+        const std::vector<ValueObject> &selectionArgs) const;
     int EndStepQuery();
     int ChangeEncryptKey(const std::vector<uint8_t> &newKey);
 #ifdef RDB_SUPPORT_ICU
@@ -54,18 +86,28 @@ public:
 #endif
     int ExecuteForSharedBlock(int &rowNum, std::string sql, const std::vector<ValueObject> &bindArgs,
         AppDataFwk::SharedBlock *sharedBlock, int startPos, int requiredPos, bool isCountAllRows);
+    void RefreshSchema(uint64_t generation);
+    int GetWalPages() const;
+    int Checkpoint(CheckpointPolicy policy, int &checkpointedPages);
 
 private:
     explicit SqliteConnection(bool isWriteConnection);
     int InnerOpen(const SqliteConfig &config);
     int Config(const SqliteConfig &config);
-    int SetPageSize();
+    int SetPageSize(int pageSize);
     int SetEncryptKey(const std::vector<uint8_t> &encryptKey);
     int SetJournalMode(const std::string &journalMode, const std::string &synclMode);
-    int SetJournalSizeLimit();
-    int SetAutoCheckpoint();
+    int SetJournalSizeLimit(int journalSizeLimit);
+    int SetAutoCheckpoint(CheckpointPolicy policy, int autoCheckpoint);
+    int SetCacheSize(int cacheSize);
+    int SetMmapSize(int64_t mmapSize);
+    int SetTempStore(TempStore tempStore);
+    static int WalHook(void *data, sqlite3 *db, const char *dbName, int pages);
     int SetWalSyncMode(const std::string &syncMode);
     int PrepareAndBind(const std::string &sql, const std::vector<ValueObject> &bindArgs);
+    int PrepareStatement(const std::string &sql);
+    int PreparePinnedStatement(const std::shared_ptr<const PinnedSql> &pinnedSql);
+    void ClearStatementCache();
     void LimitPermission(const std::string &dbPath) const;
 
     int SetPersistWal();
@@ -74,8 +116,22 @@ private:
     sqlite3 *dbHandle;
     bool isWriteConnection;
     bool isReadOnly;
-    SqliteStatement statement;
+    std::shared_ptr<SqliteStatement> statement;
     std::shared_ptr<SqliteStatement> stepStatement;
+    using CachedStatement = std::pair<std::string, std::shared_ptr<SqliteStatement>>;
+    std::list<CachedStatement> statementCache;
+    std::unordered_map<std::string, std::list<CachedStatement>::iterator> statementCacheIndex;
+    size_t statementCacheSize;
+    struct PinnedStatement {
+        std::weak_ptr<const PinnedSql> owner;
+        std::shared_ptr<SqliteStatement> statement;
+    };
+    std::unordered_map<std::string, PinnedStatement> pinnedStatements;
+    StatementCacheStats *cacheStats;
+    uint64_t schemaGeneration;
+    // pages in the WAL file not checkpointed yet, only tracked when the checkpoints run in the background
+    std::atomic<int> walPages;
+    int checkpointedWalPages;
     std::string filePath;
     int openFlags;
     std::mutex rdbMutex;
@@ -16,7 +16,12 @@
 #ifndef NATIVE_RDB_SQLITE_CONNECTION_POOL_H
 #define NATIVE_RDB_SQLITE_CONNECTION_POOL_H
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
 #include <mutex>
 #include <vector>
 #include <sstream>
@@ -28,33 +33,85 @@
 #include "sqlite_config.h"
 #include "sqlite_connection.h"
 #include "base_transaction.h"
+#include "task_scheduler.h"
 
 namespace OHOS {
 namespace NativeRdb {
 
+/**
+ * Acquisition statistics of the write connection or of the read connections of a pool.
+ */
+struct ConnectionPoolStats {
+    // upper bounds in microseconds of the wait time buckets, the last bucket counts all longer waits
+    static constexpr int64_t WAIT_TIME_BOUNDS[] = { 100, 1000, 10000, 100000, 1000000 };
+    static constexpr int WAIT_TIME_BUCKET_COUNT = 6;
+    uint64_t waitTimeHistogram[WAIT_TIME_BUCKET_COUNT] = {};
+    uint64_t acquireCount = 0;
+    uint64_t busyCount = 0;
+    int maxQueueDepth = 0;
+    uint64_t releaseCount = 0;
+    int64_t totalHoldTime = 0; // microseconds
+    int64_t maxHoldTime = 0;   // microseconds
+};
+
+/**
+ * Statistics of the checkpoints run in the background.
+ */
+struct CheckpointStats {
+    uint64_t checkpointCount = 0;
+    uint64_t incompleteCount = 0; // checkpoints that left pages in the WAL file for active readers
+    uint64_t checkpointedPages = 0;
+    int64_t totalTime = 0; // microseconds
+    int64_t maxTime = 0;   // microseconds
+    int walPages = 0;      // pages currently in the WAL file
+};
+
 class SqliteConnectionPool {
 public:
     static SqliteConnectionPool *Create(const RdbStoreConfig &storeConfig, int &errCode);
     ~SqliteConnectionPool();
-    SqliteConnection *AcquireConnection(bool isReadOnly);
+    SqliteConnection *AcquireConnection(bool isReadOnly, int &errCode);
     void ReleaseConnection(SqliteConnection *connection);
     int ChangeEncryptKey(const std::vector<uint8_t> &newKey);
-    int ReOpenAvailableReadConnections();
+    void NotifySchemaChanged();
 #ifdef RDB_SUPPORT_ICU
     int ConfigLocale(const std::string localeStr);
 #endif
     int ChangeDbFileForRestore(const std::string newPath, const std::string backupPath,
         const std::vector<uint8_t> &newKey);
     std::stack<BaseTransaction> &getTransactionStack();
+    void GetStatementCacheStats(uint64_t &hits, uint64_t &misses) const;
+    void GetReadConnectionCount(int &total, int &idle);
+    bool ReservePrefetchConnection();
+    void ReleasePrefetchConnection();
+    void GetConnectionPoolStats(ConnectionPoolStats &writeStats, ConnectionPoolStats &readStats);
+    void GetCheckpointStats(CheckpointStats &stats);
 
 private:
+    using Clock = std::chrono::steady_clock;
+    // FIFO queue of the threads waiting for one kind of connection, guarded by the mutex of that kind
+    struct WaitQueue {
+        std::deque<uint64_t> tickets;
+        uint64_t nextTicket = 0;
+        ConnectionPoolStats stats;
+    };
+
     explicit SqliteConnectionPool(const RdbStoreConfig &storeConfig);
     int Init();
     void InitReadConnectionCount();
-    SqliteConnection *AcquireWriteConnection();
+    bool WaitInQueue(WaitQueue &queue, std::condition_variable &condition, std::unique_lock<std::mutex> &lock,
+        const std::function<bool()> &isAvailable);
+    static void RecordHoldTime(ConnectionPoolStats &stats, Clock::time_point acquireTime);
+    SqliteConnection *AcquireWriteConnection(int &errCode);
     void ReleaseWriteConnection();
-    SqliteConnection *AcquireReadConnection();
+    SqliteConnection *AcquireReadConnection(int &errCode);
     void ReleaseReadConnection(SqliteConnection *connection);
+    SqliteConnection *OpenReadConnection(int &errCode);
+    void ScheduleIdleReadCheck();
+    void CloseIdleReadConnections();
+    TaskScheduler::TaskId ScheduleCheckpoint();
+    void ScheduleCheckpointTask(std::chrono::milliseconds delay);
+    void RunCheckpoint(uint64_t sequence);
     void CloseAllConnections();
     bool IsOverLength(const std::vector<uint8_t> &newKey);
     int InnerReOpenReadConnections();
@@ -64,16 +121,44 @@ private:
     std::mutex writeMutex;
     std::condition_variable writeCondition;
     bool writeConnectionUsed;
+    WaitQueue writeQueue;
+    Clock::time_point writeAcquireTime;
+    std::chrono::milliseconds acquireTimeout;
+    // background checkpoints, guarded by the write mutex
+    CheckpointPolicy checkpointPolicy;
+    int checkpointWalPages;
+    std::chrono::milliseconds checkpointIdleTime;
+    Clock::time_point lastWriteTime;
+    TaskScheduler::TaskId checkpointTaskId;
+    uint64_t checkpointSequence; // identifies the pending checkpoint task, earlier tasks are stale
+    bool isCheckpointDue;        // the pending checkpoint task runs without waiting for the idle time
+    CheckpointStats checkpointStats;
 
-    std::vector<SqliteConnection *> readConnections;
+    // idle read connections with the time they were released, the front one is the least recently used
+    std::deque<std::pair<SqliteConnection *, Clock::time_point>> readConnections;
     std::mutex readMutex;
     std::mutex rdbMutex;
     std::condition_variable readCondition;
+    WaitQueue readQueue;
+    std::map<SqliteConnection *, Clock::time_point> busyReadConnections;
     int readConnectionCount;
     int idleReadConnectionCount;
+    int minReadConnectionCount;
+    int maxReadConnectionCount;
+    // read connections kept by the prefetch workers of result sets, one is always left to the other reads
+    int prefetchConnectionCount;
+    // increased by each DDL, read connections drop their cached statements when they fall behind
+    std::atomic<uint64_t> schemaGeneration;
+    std::chrono::milliseconds readConnectionIdleTimeout;
+    TaskScheduler::TaskId idleCheckTaskId;
+    bool isClosing; // guarded by both the read mutex and the write mutex
+#ifdef RDB_SUPPORT_ICU
+    std::string locale;
+#endif
     const static int LIMITATION = 1024;
 
     std::stack<BaseTransaction> transactionStack;
+    StatementCacheStats statementCacheStats;
 };
 
 } // namespace NativeRdb
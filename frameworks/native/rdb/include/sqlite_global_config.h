@@ -16,6 +16,7 @@
 #ifndef NATIVE_RDB_SQLITE_GLOBAL_CONFIG_H
 #define NATIVE_RDB_SQLITE_GLOBAL_CONFIG_H
 
+#include <cstdint>
 #include <string>
 
 namespace OHOS {
@@ -28,23 +29,44 @@ public:
     static void InitSqliteGlobalConfig();
     static void SqliteLogCallback(const void *data, int err, const char *msg);
     static int GetReadConnectionCount();
+    static int GetMinReadConnectionCount();
+    static int GetReadConnectionIdleTimeout();
+    static int GetConnectionAcquireTimeout();
     static std::string GetMemoryDbPath();
     static int GetPageSize();
     static std::string GetWalSyncMode();
     static int GetJournalFileSize();
     static int GetWalAutoCheckpoint();
+    static int GetCheckpointWalPages();
+    static int GetCheckpointIdleTime();
+    static int GetCacheSize(bool isWriteConnection);
+    static int64_t GetMmapSize(bool isWriteConnection);
+    static int64_t GetReadMmapSizeLimit();
     static std::string GetDefaultJournalMode();
+    static int GetStatementCacheSize();
+    static bool IsJsonSupported();
 
 private:
     static const int SOFT_HEAP_LIMIT;
     static const bool CALLBACK_LOG_SWITCH;
     static const int CONNECTION_POOL_SIZE;
+    static const int MIN_READ_CONNECTION_COUNT;
+    static const int READ_CONNECTION_IDLE_TIMEOUT;
+    static const int CONNECTION_ACQUIRE_TIMEOUT;
     static const std::string MEMORY_DB_PATH;
     static const int DB_PAGE_SIZE;
     static const std::string DEFAULT_JOURNAL_MODE;
     static const std::string WAL_SYNC_MODE;
     static const int JOURNAL_FILE_SIZE;
     static const int WAL_AUTO_CHECKPOINT;
+    static const int CHECKPOINT_WAL_PAGES;
+    static const int CHECKPOINT_IDLE_TIME;
+    static const int WRITE_CACHE_SIZE;
+    static const int READ_CACHE_SIZE;
+    static const int64_t MMAP_SIZE;
+    static const int64_t READ_MMAP_SIZE_LIMIT;
+    static const int STATEMENT_CACHE_SIZE;
+    static const int JSON_BUILTIN_VERSION;
 };
 
 } // namespace NativeRdb
@@ -17,6 +17,7 @@
 #ifndef NATIVE_RDB_SQLITE_SHARED_RESULT_SET_H
 #define NATIVE_RDB_SQLITE_SHARED_RESULT_SET_H
 
+#include <condition_variable>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -33,7 +34,7 @@ namespace NativeRdb {
 class SqliteSharedResultSet : public AbsSharedResultSet {
 public:
     SqliteSharedResultSet(std::shared_ptr<RdbStoreImpl> rdbSreImpl, std::string path, std::string sql,
-        const std::vector<std::string> &selectionArgVec);
+        const std::vector<ValueObject> &selectionArgVec);
     ~SqliteSharedResultSet() override;
     int GetAllColumnNames(std::vector<std::string> &columnNames) override;
     int Close() override;
@@ -43,6 +44,10 @@ public:
     std::shared_ptr<RdbStore> GetRdbStore() const;
     int PickFillBlockStartPosition(int resultSetPosition, int blockCapacity) const;
     void SetFillBlockForwardOnly(bool isOnlyFillResultSetBlockInput);
+    int SetColumnarColumns(const std::vector<int> &columnIndexes) override;
+    int SetBlockSizeLimits(size_t minBlockSize, size_t maxBlockSize) override;
+    int GetBlockStats(BlockStats &stats) const override;
+    int SetPrefetchNextBlock(bool isPrefetch) override;
 
 protected:
     void Finalize() override;
@@ -51,12 +56,25 @@ private:
     int PrepareStep();
     int CheckSession();
     void FillSharedBlock(int requiredPos);
+    int FillWindow(int requiredPos);
+    size_t PickBlockSize(int requiredPos) const;
+    bool ResizeBlock(size_t blockSize);
+    void RecordBlockFilled();
+    void StartPrefetch();
+    void StopPrefetch();
+    void PrefetchLoop(int startPos);
+    bool FillPrefetchBlock(SqliteStatement &statement, bool &hasRow);
+    bool TakePrefetchedBlock(int requiredPos);
 
 private:
     // The specified value is -1 when there is no data
     static const int NO_COUNT = -1;
     // The pick position of the shared block for search
     static const int PICK_POS = 3;
+    // The size of the first block, and the default limits of the blocks picked for the later windows
+    static const size_t INITIAL_BLOCK_SIZE = 256 * 1024;
+    static const size_t MIN_BLOCK_SIZE = 64 * 1024;
+    static const size_t MAX_BLOCK_SIZE = 4 * 1024 * 1024;
     // The number of rows that can fit in the shared block, 0 if unknown
     int resultSetBlockCapacity;
     // Controls fetching of rows relative to requested position
@@ -64,11 +82,28 @@ private:
     std::mutex sessionMutex;
     std::shared_ptr<RdbStoreImpl> rdbStoreImpl;
     std::string qrySql;
-    std::vector<std::string> selectionArgVec;
+    std::vector<ValueObject> selectionArgVec;
     std::shared_ptr<SqliteStatement> sqliteStatement;
     std::thread::id tid;
     // The number of rows in the cursor
     int rowNum;
+    // The column names, obtained by the first GetAllColumnNames
+    std::vector<std::string> queryColumnNames;
+    size_t minBlockSize;
+    size_t maxBlockSize;
+    BlockStats blockStats;
+    // The columns kept column-major, set again on every block leased for a new size
+    std::vector<uint32_t> columnarColumns;
+    // The next window filled on prefetchThread while the current one is read, see SetPrefetchNextBlock
+    enum PrefetchState { PREFETCH_IDLE, PREFETCH_FILLING, PREFETCH_READY, PREFETCH_FAILED };
+    bool isPrefetch;
+    bool isPrefetchStopping;
+    PrefetchState prefetchState;
+    int prefetchStartPos;
+    AppDataFwk::SharedBlock *prefetchBlock;
+    std::thread prefetchThread;
+    std::mutex prefetchMutex;
+    std::condition_variable prefetchCondition;
 };
 } // namespace NativeRdb
 } // namespace OHOS
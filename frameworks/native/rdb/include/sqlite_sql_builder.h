@@ -31,6 +31,9 @@ public:
     ~SqliteSqlBuilder();
     static std::string BuildDeleteString(const std::string &tableName, const std::string &index,
         const std::string &whereClause, const std::string &group, const std::string &order, int limit, int offset);
+    static std::string BuildUpsertString(const ValuesBucket &values, const std::string &tableName,
+        const std::vector<std::string> &conflictColumns, const std::vector<std::string> &updateColumns,
+        std::vector<ValueObject> &bindArgs);
     static std::string BuildUpdateString(const ValuesBucket &values, const std::string &tableName,
         const std::vector<std::string> &whereArgs, const std::string &index, const std::string &whereClause,
         const std::string &group, const std::string &order, int limit, int offset, std::vector<ValueObject> &bindArgs,
@@ -39,6 +42,14 @@ public:
         const std::vector<std::string> &whereArgs, const std::string &index, const std::string &whereClause,
         const std::string &group, const std::string &order, int limit, int offset, std::vector<ValueObject> &bindArgs,
         ConflictResolution conflictResolution);
+    static std::string BuildUpdateString(const ValuesBucket &values, const std::string &tableName,
+        const std::vector<ValueObject> &whereArgs, const std::string &index, const std::string &whereClause,
+        const std::string &group, const std::string &order, int limit, int offset, std::vector<ValueObject> &bindArgs,
+        ConflictResolution conflictResolution);
+    static std::string BuildUpdateStringOnlyWhere(const ValuesBucket &values, const std::string &tableName,
+        const std::vector<ValueObject> &whereArgs, const std::string &index, const std::string &whereClause,
+        const std::string &group, const std::string &order, int limit, int offset, std::vector<ValueObject> &bindArgs,
+        ConflictResolution conflictResolution);
     static int BuildQueryString(bool distinct, const std::string &table, const std::vector<std::string> &columns,
         const std::string &where, const std::string &groupBy, const std::string &having, const std::string &orderBy,
         const std::string &limit, const std::string &offset, std::string &outSql);
@@ -57,6 +68,7 @@ public:
         const std::vector<std::string> &columns);
     static std::string BuildCountString(const AbsRdbPredicates &predicates);
     static std::string BuildSqlStringFromPredicates(const AbsRdbPredicates &predicates);
+    static std::vector<ValueObject> ToValueObjects(const std::vector<std::string> &args);
 
 private:
     static void AppendClause(std::string &builder, const std::string &name, const std::string &clause);
@@ -29,7 +29,7 @@ public:
     ~SqliteStatement();
     int Prepare(sqlite3 *dbHandle, const std::string &sql);
     int Finalize();
-    int BindArguments(const std::vector<ValueObject> &bindArgs) const;
+    int BindArguments(const std::vector<ValueObject> &bindArgs, bool isArgsPinned = false) const;
     int ResetStatementAndClearBindings() const;
     int Step() const;
 
@@ -48,7 +48,7 @@ public:
     }
 
 private:
-    int InnerBindArguments(const std::vector<ValueObject> &bindArgs) const;
+    int InnerBindArguments(const std::vector<ValueObject> &bindArgs, bool isArgsPinned) const;
     std::string sql;
     sqlite3_stmt *stmtHandle;
     bool readOnly;
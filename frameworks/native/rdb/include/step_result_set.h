@@ -30,7 +30,7 @@ namespace NativeRdb {
 class StepResultSet : public AbsResultSet {
 public:
     StepResultSet(std::shared_ptr<RdbStoreImpl> rdb, const std::string &sql,
-        const std::vector<std::string> &selectionArgs);
+        const std::vector<ValueObject> &selectionArgs);
     ~StepResultSet() override;
 
     int GetAllColumnNames(std::vector<std::string> &columnNames) override;
@@ -57,7 +57,7 @@ private:
     void Reset();
     std::shared_ptr<RdbStoreImpl> rdb;
     std::string sql;
-    std::vector<std::string> selectionArgs;
+    std::vector<ValueObject> selectionArgs;
     // Whether reach the end of this result set or not
     bool isAfterLast;
     // The value indicates the row count of the result set
@@ -20,6 +20,7 @@
 #include <iostream>
 #include <memory>
 
+#include "group_commit_queue.h"
 #include "sqlite_connection.h"
 #include "sqlite_connection_pool.h"
 #include "value_object.h"
@@ -30,6 +31,8 @@ namespace NativeRdb {
 
 class StoreSession {
 public:
+    using BatchSqls = std::vector<std::pair<std::string, std::vector<std::vector<ValueObject>>>>;
+
     explicit StoreSession(SqliteConnectionPool &connectionPool);
     ~StoreSession();
     int ExecuteSql(const std::string &sql, const std::vector<ValueObject> &bindArgs);
@@ -37,6 +40,10 @@ public:
     int ExecuteForLastInsertedRowId(
         int64_t &outRowId, const std::string &sql, const std::vector<ValueObject> &bindArgs);
     int ExecuteGetLong(int64_t &outValue, const std::string &sql, const std::vector<ValueObject> &bindArgs);
+    int ExecuteBatch(int64_t &outChangedRows, const BatchSqls &batch, std::vector<int64_t> *rowChanges = nullptr);
+    int ExecutePinned(const std::shared_ptr<const PinnedSql> &pinnedSql, const std::vector<ValueObject> &bindArgs,
+        PinnedSql::ResultType resultType, int64_t &outValue);
+    void ExecuteGroup(std::vector<GroupCommitQueue::WriteRequest *> &batch);
     int ExecuteGetString(std::string &outValue, const std::string &sql, const std::vector<ValueObject> &bindArgs);
     int Backup(const std::string databasePath, const std::vector<uint8_t> destEncryptKey);
     bool IsHoldingConnection() const;
@@ -50,7 +57,7 @@ public:
     int EndTransaction();
     bool IsInTransaction() const;
     std::shared_ptr<SqliteStatement> BeginStepQuery(
-        int &errCode, const std::string &sql, const std::vector<std::string> &selectionArgs);
+        int &errCode, const std::string &sql, const std::vector<ValueObject> &selectionArgs);
     int EndStepQuery();
     int PrepareAndGetInfo(const std::string &sql, bool &outIsReadOnly, int &numParameters,
         std::vector<std::string> &columnNames);
@@ -64,7 +71,7 @@ public:
 
 private:
 
-    void AcquireConnection(bool isReadOnly);
+    int AcquireConnection(bool isReadOnly);
     void ReleaseConnection();
     int BeginExecuteSql(const std::string &sql);
     SqliteConnectionPool &connectionPool;
@@ -20,6 +20,8 @@
 #include <string>
 #include <vector>
 
+#include "value_object.h"
+
 namespace OHOS {
 namespace NativeRdb {
 class StringUtils {
@@ -27,6 +29,8 @@ public:
     static std::string SurroundWithQuote(std::string value, std::string quote);
     static std::string SurroundWithFunction(std::string function, std::string separator,
         std::vector<std::string> array);
+    static std::string ToString(const ValueObject &value);
+    static bool ToJsonArray(const std::vector<ValueObject> &values, std::string &json);
     static bool IsEmpty(std::string source)
     {
         return (source.empty());
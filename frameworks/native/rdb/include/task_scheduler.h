@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NATIVE_RDB_TASK_SCHEDULER_H
+#define NATIVE_RDB_TASK_SCHEDULER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+
+namespace OHOS {
+namespace NativeRdb {
+
+/**
+ * A process-wide worker thread running delayed background tasks of all stores.
+ */
+class TaskScheduler {
+public:
+    using TaskId = uint64_t;
+    using Task = std::function<void()>;
+    static constexpr TaskId INVALID_TASK_ID = 0;
+
+    static TaskScheduler &GetInstance();
+    TaskId Schedule(std::chrono::milliseconds delay, Task task);
+    void Remove(TaskId taskId);
+
+private:
+    using Clock = std::chrono::steady_clock;
+    TaskScheduler();
+    ~TaskScheduler() = default;
+    void Run();
+
+    std::mutex mutex;
+    std::condition_variable taskCondition;
+    std::condition_variable finishCondition;
+    std::multimap<Clock::time_point, TaskId> timeline;
+    std::map<TaskId, std::pair<Clock::time_point, Task>> tasks;
+    TaskId nextTaskId;
+    TaskId runningTaskId;
+};
+
+} // namespace NativeRdb
+} // namespace OHOS
+#endif
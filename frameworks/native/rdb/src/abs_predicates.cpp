@@ -19,6 +19,7 @@
 #include <initializer_list>
 
 #include "logger.h"
+#include "sqlite_global_config.h"
 #include "string_utils.h"
 
 namespace OHOS {
@@ -58,8 +59,8 @@ AbsPredicates *AbsPredicates::EqualTo(std::string field, std::string value)
         isNeedAnd = true;
     }
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " = ? ";
-    whereArgs.push_back(value);
+    whereClause.append(normalizedField).append(" = ? ");
+    bindArgs.emplace_back(value);
     return this;
 }
 
@@ -75,8 +76,8 @@ AbsPredicates *AbsPredicates::NotEqualTo(std::string field, std::string value)
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " <> ? ";
-    whereArgs.push_back(value);
+    whereClause.append(normalizedField).append(" <> ? ");
+    bindArgs.emplace_back(value);
     return this;
 }
 
@@ -134,8 +135,8 @@ AbsPredicates *AbsPredicates::Contains(std::string field, std::string value)
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " LIKE ? ";
-    whereArgs.push_back("%" + value + "%");
+    whereClause.append(normalizedField).append(" LIKE ? ");
+    bindArgs.emplace_back("%" + value + "%");
     return this;
 }
 
@@ -151,8 +152,8 @@ AbsPredicates *AbsPredicates::BeginsWith(std::string field, std::string value)
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " LIKE ? ";
-    whereArgs.push_back(value + "%");
+    whereClause.append(normalizedField).append(" LIKE ? ");
+    bindArgs.emplace_back(value + "%");
     return this;
 }
 
@@ -168,8 +169,8 @@ AbsPredicates *AbsPredicates::EndsWith(std::string field, std::string value)
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " LIKE ? ";
-    whereArgs.push_back("%" + value);
+    whereClause.append(normalizedField).append(" LIKE ? ");
+    bindArgs.emplace_back("%" + value);
     return this;
 }
 
@@ -185,7 +186,7 @@ AbsPredicates *AbsPredicates::IsNull(std::string field)
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " is null ";
+    whereClause.append(normalizedField).append(" is null ");
     return this;
 }
 
@@ -201,7 +202,7 @@ AbsPredicates *AbsPredicates::IsNotNull(std::string field)
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " is not null ";
+    whereClause.append(normalizedField).append(" is not null ");
     return this;
 }
 
@@ -217,8 +218,8 @@ AbsPredicates *AbsPredicates::Like(std::string field, std::string value)
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " LIKE ? ";
-    whereArgs.push_back(value);
+    whereClause.append(normalizedField).append(" LIKE ? ");
+    bindArgs.emplace_back(value);
     return this;
 }
 
@@ -234,8 +235,8 @@ AbsPredicates *AbsPredicates::Glob(std::string field, std::string value)
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " GLOB ? ";
-    whereArgs.push_back(value);
+    whereClause.append(normalizedField).append(" GLOB ? ");
+    bindArgs.emplace_back(value);
     return this;
 }
 
@@ -251,9 +252,9 @@ AbsPredicates *AbsPredicates::Between(std::string field, std::string low, std::s
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " BETWEEN ? AND ? ";
-    whereArgs.push_back(low);
-    whereArgs.push_back(high);
+    whereClause.append(normalizedField).append(" BETWEEN ? AND ? ");
+    bindArgs.emplace_back(low);
+    bindArgs.emplace_back(high);
     return this;
 }
 
@@ -269,9 +270,9 @@ AbsPredicates *AbsPredicates::NotBetween(std::string field, std::string low, std
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " NOT BETWEEN ? AND ? ";
-    whereArgs.push_back(low);
-    whereArgs.push_back(high);
+    whereClause.append(normalizedField).append(" NOT BETWEEN ? AND ? ");
+    bindArgs.emplace_back(low);
+    bindArgs.emplace_back(high);
     return this;
 }
 
@@ -287,8 +288,8 @@ AbsPredicates *AbsPredicates::GreaterThan(std::string field, std::string value)
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " > ? ";
-    whereArgs.push_back(value);
+    whereClause.append(normalizedField).append(" > ? ");
+    bindArgs.emplace_back(value);
     return this;
 }
 
@@ -304,8 +305,8 @@ AbsPredicates *AbsPredicates::LessThan(std::string field, std::string value)
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " < ? ";
-    whereArgs.push_back(value);
+    whereClause.append(normalizedField).append(" < ? ");
+    bindArgs.emplace_back(value);
     return this;
 }
 
@@ -321,8 +322,8 @@ AbsPredicates *AbsPredicates::GreaterThanOrEqualTo(std::string field, std::strin
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " >= ? ";
-    whereArgs.push_back(value);
+    whereClause.append(normalizedField).append(" >= ? ");
+    bindArgs.emplace_back(value);
     return this;
 }
 
@@ -338,8 +339,8 @@ AbsPredicates *AbsPredicates::LessThanOrEqualTo(std::string field, std::string v
     }
     CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + " <= ? ";
-    whereArgs.push_back(value);
+    whereClause.append(normalizedField).append(" <= ? ");
+    bindArgs.emplace_back(value);
     return this;
 }
 
@@ -358,7 +359,7 @@ AbsPredicates *AbsPredicates::OrderByAsc(std::string field)
         order += ',';
     }
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    order = order + normalizedField + " ASC ";
+    order.append(normalizedField).append(" ASC ");
     isSorted = true;
     return this;
 }
@@ -378,7 +379,7 @@ AbsPredicates *AbsPredicates::OrderByDesc(std::string field)
         order += ',';
     }
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    order = order + normalizedField + " DESC ";
+    order.append(normalizedField).append(" DESC ");
     isSorted = true;
     return this;
 }
@@ -439,7 +440,7 @@ AbsPredicates *AbsPredicates::GroupBy(std::vector<std::string> fields)
             return this;
         }
         std::string normalizedField = Normalized(RemoveQuotes(field));
-        group = group + normalizedField + ",";
+        group.append(normalizedField).append(",");
     }
     size_t pos = group.find_last_of(",");
     if (pos != group.npos) {
@@ -479,12 +480,11 @@ AbsPredicates *AbsPredicates::In(std::string field, std::vector<std::string> val
 
     CheckIsNeedAnd();
 
-    std::vector<std::string> replaceValues;
-    for (auto i : values) {
-        replaceValues.push_back("?");
-        whereArgs.push_back(i);
+    bindArgs.reserve(bindArgs.size() + values.size());
+    for (auto &value : values) {
+        bindArgs.emplace_back(std::move(value));
     }
-    AppendWhereClauseWithInOrNotIn(" IN ", field, replaceValues);
+    AppendWhereClauseWithInOrNotIn(" IN ", field, values.size());
     return this;
 }
 
@@ -503,21 +503,73 @@ AbsPredicates *AbsPredicates::NotIn(std::string field, std::vector<std::string>
         return this;
     }
     CheckIsNeedAnd();
-    std::vector<std::string> replaceValues;
-    for (auto i : values) {
-        replaceValues.push_back("?");
-        whereArgs.push_back(i);
+    bindArgs.reserve(bindArgs.size() + values.size());
+    for (auto &value : values) {
+        bindArgs.emplace_back(std::move(value));
     }
-    AppendWhereClauseWithInOrNotIn(" NOT IN ", field, replaceValues);
+    AppendWhereClauseWithInOrNotIn(" NOT IN ", field, values.size());
     return this;
 }
 
+/**
+ * Restricts the value of the field to be equal to the specified typed value.
+ */
+AbsPredicates *AbsPredicates::EqualTo(std::string field, ValueObject value)
+{
+    return AppendCompare("EqualTo", field, " = ? ", std::move(value));
+}
+
+AbsPredicates *AbsPredicates::NotEqualTo(std::string field, ValueObject value)
+{
+    return AppendCompare("NotEqualTo", field, " <> ? ", std::move(value));
+}
+
+AbsPredicates *AbsPredicates::Between(std::string field, ValueObject low, ValueObject high)
+{
+    return AppendRange("Between", field, " BETWEEN ? AND ? ", std::move(low), std::move(high));
+}
+
+AbsPredicates *AbsPredicates::NotBetween(std::string field, ValueObject low, ValueObject high)
+{
+    return AppendRange("NotBetween", field, " NOT BETWEEN ? AND ? ", std::move(low), std::move(high));
+}
+
+AbsPredicates *AbsPredicates::GreaterThan(std::string field, ValueObject value)
+{
+    return AppendCompare("GreaterThan", field, " > ? ", std::move(value));
+}
+
+AbsPredicates *AbsPredicates::LessThan(std::string field, ValueObject value)
+{
+    return AppendCompare("LessThan", field, " < ? ", std::move(value));
+}
+
+AbsPredicates *AbsPredicates::GreaterThanOrEqualTo(std::string field, ValueObject value)
+{
+    return AppendCompare("GreaterThanOrEqualTo", field, " >= ? ", std::move(value));
+}
+
+AbsPredicates *AbsPredicates::LessThanOrEqualTo(std::string field, ValueObject value)
+{
+    return AppendCompare("LessThanOrEqualTo", field, " <= ? ", std::move(value));
+}
+
+AbsPredicates *AbsPredicates::In(std::string field, std::vector<ValueObject> values)
+{
+    return AppendInOrNotIn("In", field, " IN ", std::move(values));
+}
+
+AbsPredicates *AbsPredicates::NotIn(std::string field, std::vector<ValueObject> values)
+{
+    return AppendInOrNotIn("NotIn", field, " NOT IN ", std::move(values));
+}
+
 void AbsPredicates::Initial()
 {
     distinct = false;
     isNeedAnd = false;
     isSorted = false;
-    whereArgs.clear();
+    bindArgs.clear();
     whereClause.clear();
     order.clear();
     group.clear();
@@ -595,11 +647,104 @@ void AbsPredicates::CheckIsNeedAnd()
     }
 }
 
-void AbsPredicates::AppendWhereClauseWithInOrNotIn(
-    std::string methodName, std::string field, std::vector<std::string> replaceValues)
+/**
+ * Appends "field IN (? , ?)" with one placeholder per value, written in place into the where clause.
+ */
+void AbsPredicates::AppendWhereClauseWithInOrNotIn(std::string methodName, std::string field, size_t count)
+{
+    const std::string separator = " , ";
+    std::string normalizedField = Normalized(RemoveQuotes(field));
+    whereClause.reserve(whereClause.size() + normalizedField.size() + methodName.size() + count * (separator.size() + 1)
+        + 2);
+    whereClause.append(normalizedField).append(methodName).append("(");
+    for (size_t i = 0; i < count; i++) {
+        if (i != 0) {
+            whereClause.append(separator);
+        }
+        whereClause.append("?");
+    }
+    whereClause.append(")");
+}
+
+/**
+ * Appends a comparison of the field with one typed value, bound as it is.
+ */
+AbsPredicates *AbsPredicates::AppendCompare(std::string methodName, std::string field, std::string op,
+    ValueObject value)
+{
+    if (!CheckParameter(methodName, field, {})) {
+        LOG_WARN("AbsPredicates: %{public}s() fails because Invalid parameter.", methodName.c_str());
+        return this;
+    }
+    CheckIsNeedAnd();
+    std::string normalizedField = Normalized(RemoveQuotes(field));
+    whereClause.append(normalizedField).append(op);
+    bindArgs.push_back(std::move(value));
+    return this;
+}
+
+AbsPredicates *AbsPredicates::AppendRange(std::string methodName, std::string field, std::string op,
+    ValueObject low, ValueObject high)
 {
+    if (!CheckParameter(methodName, field, {})) {
+        LOG_WARN("AbsPredicates: %{public}s() fails because Invalid parameter.", methodName.c_str());
+        return this;
+    }
+    CheckIsNeedAnd();
     std::string normalizedField = Normalized(RemoveQuotes(field));
-    whereClause = whereClause + normalizedField + StringUtils::SurroundWithFunction(methodName, ",", replaceValues);
+    whereClause.append(normalizedField).append(op);
+    bindArgs.push_back(std::move(low));
+    bindArgs.push_back(std::move(high));
+    return this;
+}
+
+AbsPredicates *AbsPredicates::AppendInOrNotIn(std::string methodName, std::string field, std::string op,
+    std::vector<ValueObject> values)
+{
+    if (!CheckParameter(methodName, field, {})) {
+        LOG_WARN("AbsPredicates: %{public}s() fails because Invalid parameter.", methodName.c_str());
+        return this;
+    }
+    if (values.empty()) {
+        LOG_WARN("AbsPredicates: %{public}s() fails because values can't be null.", methodName.c_str());
+        return this;
+    }
+    CheckIsNeedAnd();
+    bindArgs.reserve(bindArgs.size() + values.size());
+    for (auto &value : values) {
+        bindArgs.push_back(std::move(value));
+    }
+    AppendWhereClauseWithInOrNotIn(op, field, values.size());
+    return this;
+}
+
+AbsPredicates *AbsPredicates::InLargeSet(std::string field, std::vector<ValueObject> values)
+{
+    return AppendInOrNotInLargeSet("InLargeSet", field, " IN ", std::move(values));
+}
+
+AbsPredicates *AbsPredicates::NotInLargeSet(std::string field, std::vector<ValueObject> values)
+{
+    return AppendInOrNotInLargeSet("NotInLargeSet", field, " NOT IN ", std::move(values));
+}
+
+AbsPredicates *AbsPredicates::AppendInOrNotInLargeSet(std::string methodName, std::string field, std::string op,
+    std::vector<ValueObject> values)
+{
+    std::string array;
+    if (values.size() <= LARGE_SET_THRESHOLD || !SqliteGlobalConfig::IsJsonSupported()
+        || !StringUtils::ToJsonArray(values, array)) {
+        return AppendInOrNotIn(methodName, field, op, std::move(values));
+    }
+    if (!CheckParameter(methodName, field, {})) {
+        LOG_WARN("AbsPredicates: %{public}s() fails because Invalid parameter.", methodName.c_str());
+        return this;
+    }
+    CheckIsNeedAnd();
+    std::string normalizedField = Normalized(RemoveQuotes(field));
+    whereClause.append(normalizedField).append(op).append("(SELECT value FROM json_each(?))");
+    bindArgs.emplace_back(std::move(array));
+    return this;
 }
 
 std::string AbsPredicates::GetWhereClause() const
@@ -615,14 +760,36 @@ void AbsPredicates::SetWhereClause(std::string whereClause)
     this->whereClause = whereClause;
 }
 
+/**
+ * Obtains the text form of the bind arguments, the typed arguments are available from GetBindArgs.
+ */
 std::vector<std::string> AbsPredicates::GetWhereArgs() const
 {
+    std::vector<std::string> whereArgs;
+    whereArgs.reserve(bindArgs.size());
+    for (const auto &arg : bindArgs) {
+        whereArgs.push_back(StringUtils::ToString(arg));
+    }
     return whereArgs;
 }
 
 void AbsPredicates::SetWhereArgs(std::vector<std::string> whereArgs)
 {
-    this->whereArgs = whereArgs;
+    bindArgs.clear();
+    bindArgs.reserve(whereArgs.size());
+    for (auto &arg : whereArgs) {
+        bindArgs.emplace_back(arg);
+    }
+}
+
+std::vector<ValueObject> AbsPredicates::GetBindArgs() const
+{
+    return bindArgs;
+}
+
+void AbsPredicates::SetBindArgs(std::vector<ValueObject> bindArgs)
+{
+    this->bindArgs = std::move(bindArgs);
 }
 
 std::string AbsPredicates::GetOrder() const
@@ -19,6 +19,7 @@
 #include "logger.h"
 #include "rdb_manager.h"
 #include "rdb_service.h"
+#include "string_utils.h"
 
 namespace OHOS::NativeRdb {
 AbsRdbPredicates::AbsRdbPredicates(std::string tableName)
@@ -36,6 +37,7 @@ void AbsRdbPredicates::Clear()
 {
     AbsPredicates::Clear();
     InitialParam();
+    hasLocalCondition_ = false;
 }
 
 void AbsRdbPredicates::InitialParam()
@@ -155,6 +157,9 @@ AbsRdbPredicates* AbsRdbPredicates::InAllDevices()
 
 const DistributedRdb::RdbPredicates& AbsRdbPredicates::GetDistributedPredicates() const
 {
+    if (hasLocalCondition_) {
+        LOG_WARN("range and set conditions of table %{public}s are not synchronized", tableName.c_str());
+    }
     int limit = GetLimit();
     if (limit >= 0) {
         predicates_.AddOperation(DistributedRdb::RdbPredicateOperator::LIMIT,
@@ -175,6 +180,96 @@ AbsRdbPredicates* AbsRdbPredicates::NotEqualTo(std::string field, std::string va
     return (AbsRdbPredicates *)AbsPredicates::NotEqualTo(field, value);
 }
 
+AbsRdbPredicates* AbsRdbPredicates::EqualTo(std::string field, ValueObject value)
+{
+    std::string text = StringUtils::ToString(value);
+    predicates_.AddOperation(DistributedRdb::EQUAL_TO, field, text);
+    return (AbsRdbPredicates *)AbsPredicates::EqualTo(field, std::move(value));
+}
+
+AbsRdbPredicates* AbsRdbPredicates::NotEqualTo(std::string field, ValueObject value)
+{
+    std::string text = StringUtils::ToString(value);
+    predicates_.AddOperation(DistributedRdb::NOT_EQUAL_TO, field, text);
+    return (AbsRdbPredicates *)AbsPredicates::NotEqualTo(field, std::move(value));
+}
+
+AbsRdbPredicates* AbsRdbPredicates::Between(std::string field, ValueObject low, ValueObject high)
+{
+    hasLocalCondition_ = true;
+    return (AbsRdbPredicates *)AbsPredicates::Between(field, std::move(low), std::move(high));
+}
+
+AbsRdbPredicates* AbsRdbPredicates::NotBetween(std::string field, ValueObject low, ValueObject high)
+{
+    hasLocalCondition_ = true;
+    return (AbsRdbPredicates *)AbsPredicates::NotBetween(field, std::move(low), std::move(high));
+}
+
+AbsRdbPredicates* AbsRdbPredicates::GreaterThan(std::string field, ValueObject value)
+{
+    hasLocalCondition_ = true;
+    return (AbsRdbPredicates *)AbsPredicates::GreaterThan(field, std::move(value));
+}
+
+AbsRdbPredicates* AbsRdbPredicates::LessThan(std::string field, ValueObject value)
+{
+    hasLocalCondition_ = true;
+    return (AbsRdbPredicates *)AbsPredicates::LessThan(field, std::move(value));
+}
+
+AbsRdbPredicates* AbsRdbPredicates::GreaterThanOrEqualTo(std::string field, ValueObject value)
+{
+    hasLocalCondition_ = true;
+    return (AbsRdbPredicates *)AbsPredicates::GreaterThanOrEqualTo(field, std::move(value));
+}
+
+AbsRdbPredicates* AbsRdbPredicates::LessThanOrEqualTo(std::string field, ValueObject value)
+{
+    hasLocalCondition_ = true;
+    return (AbsRdbPredicates *)AbsPredicates::LessThanOrEqualTo(field, std::move(value));
+}
+
+/**
+ * A single value is synchronized as an equality, the distributed predicates can not group the others.
+ */
+AbsRdbPredicates* AbsRdbPredicates::In(std::string field, std::vector<ValueObject> values)
+{
+    if (values.size() == 1) {
+        predicates_.AddOperation(DistributedRdb::EQUAL_TO, field, StringUtils::ToString(values[0]));
+    } else {
+        hasLocalCondition_ = true;
+    }
+    return (AbsRdbPredicates *)AbsPredicates::In(field, std::move(values));
+}
+
+/**
+ * Synchronized as inequalities joined by AND, which keep their meaning next to the other conditions.
+ */
+AbsRdbPredicates* AbsRdbPredicates::NotIn(std::string field, std::vector<ValueObject> values)
+{
+    std::string empty;
+    for (size_t i = 0; i < values.size(); i++) {
+        if (i != 0) {
+            predicates_.AddOperation(DistributedRdb::AND, empty, empty);
+        }
+        predicates_.AddOperation(DistributedRdb::NOT_EQUAL_TO, field, StringUtils::ToString(values[i]));
+    }
+    return (AbsRdbPredicates *)AbsPredicates::NotIn(field, std::move(values));
+}
+
+AbsRdbPredicates* AbsRdbPredicates::InLargeSet(std::string field, std::vector<ValueObject> values)
+{
+    hasLocalCondition_ = true;
+    return (AbsRdbPredicates *)AbsPredicates::InLargeSet(field, std::move(values));
+}
+
+AbsRdbPredicates* AbsRdbPredicates::NotInLargeSet(std::string field, std::vector<ValueObject> values)
+{
+    hasLocalCondition_ = true;
+    return (AbsRdbPredicates *)AbsPredicates::NotInLargeSet(field, std::move(values));
+}
+
 AbsRdbPredicates* AbsRdbPredicates::And()
 {
     std::string field;
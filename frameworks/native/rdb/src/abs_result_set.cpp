@@ -21,7 +21,7 @@
 
 namespace OHOS {
 namespace NativeRdb {
-AbsResultSet::AbsResultSet() : rowPos(INIT_POS), isClosed(false)
+AbsResultSet::AbsResultSet() : rowPos(INIT_POS), isClosed(false), isColumnIndexReady(false)
 {}
 
 AbsResultSet::~AbsResultSet() {}
@@ -175,60 +175,97 @@ int AbsResultSet::IsEnded(bool &result)
     return E_OK;
 }
 
-int AbsResultSet::GetColumnCount(int &count)
+/**
+ * Obtains the column names once, the result set keeps them for the name and index lookups.
+ */
+int AbsResultSet::InitColumnIndex()
 {
+    if (isColumnIndexReady) {
+        return E_OK;
+    }
     std::vector<std::string> columnNames;
     int ret = GetAllColumnNames(columnNames);
     if (ret != E_OK) {
-        LOG_ERROR("AbsResultSet::GetColumnCount  return GetAllColumnNames::ret is wrong!");
+        LOG_ERROR("AbsResultSet::InitColumnIndex  return GetAllColumnNames::ret is wrong!");
         return ret;
     }
-    count = static_cast<int>(columnNames.size());
+    columnIndexMap.clear();
+    columnIndexMap.reserve(columnNames.size());
+    for (size_t i = 0; i < columnNames.size(); i++) {
+        // the first of the columns sharing a name wins
+        columnIndexMap.emplace(ToColumnKey(columnNames[i]), static_cast<int>(i));
+    }
+    columnNameCache = std::move(columnNames);
+    isColumnIndexReady = true;
     return E_OK;
 }
 
-int AbsResultSet::GetColumnIndex(const std::string &columnName, int &columnIndex)
+std::string AbsResultSet::ToColumnKey(const std::string &columnName)
 {
     auto periodIndex = columnName.rfind('.');
-    std::string columnNameLower = columnName;
-    if (periodIndex != std::string::npos) {
-        columnNameLower = columnNameLower.substr(periodIndex + 1);
+    std::string key = (periodIndex == std::string::npos) ? columnName : columnName.substr(periodIndex + 1);
+    transform(key.begin(), key.end(), key.begin(), ::tolower);
+    return key;
+}
+
+int AbsResultSet::GetColumnCount(int &count)
+{
+    int ret = InitColumnIndex();
+    if (ret != E_OK) {
+        LOG_ERROR("AbsResultSet::GetColumnCount  return GetAllColumnNames::ret is wrong!");
+        return ret;
     }
-    transform(columnNameLower.begin(), columnNameLower.end(), columnNameLower.begin(), ::tolower);
-    std::vector<std::string> columnNames;
-    int ret = GetAllColumnNames(columnNames);
+    count = static_cast<int>(columnNameCache.size());
+    return E_OK;
+}
+
+int AbsResultSet::GetColumnIndex(const std::string &columnName, int &columnIndex)
+{
+    int ret = InitColumnIndex();
     if (ret != E_OK) {
         LOG_ERROR("AbsResultSet::GetColumnIndex  return GetAllColumnNames::ret is wrong!");
         return ret;
     }
 
-    columnIndex = 0;
-    for (const auto& name : columnNames) {
-        std::string lowerName = name;
-        transform(name.begin(), name.end(), lowerName.begin(), ::tolower);
-        if (lowerName == columnNameLower) {
-            return E_OK;
-        }
-        columnIndex++;
+    auto iter = columnIndexMap.find(ToColumnKey(columnName));
+    if (iter == columnIndexMap.end()) {
+        columnIndex = -1;
+        return E_ERROR;
     }
-    columnIndex = -1;
-    return E_ERROR;
+    columnIndex = iter->second;
+    return E_OK;
+}
+
+int AbsResultSet::GetColumnIndexes(const std::vector<std::string> &columnNames, std::vector<int> &columnIndexes)
+{
+    int ret = InitColumnIndex();
+    if (ret != E_OK) {
+        LOG_ERROR("AbsResultSet::GetColumnIndexes  return GetAllColumnNames::ret is wrong!");
+        return ret;
+    }
+
+    columnIndexes.clear();
+    columnIndexes.reserve(columnNames.size());
+    ret = E_OK;
+    for (const auto &columnName : columnNames) {
+        auto iter = columnIndexMap.find(ToColumnKey(columnName));
+        columnIndexes.push_back((iter == columnIndexMap.end()) ? -1 : iter->second);
+        ret = (iter == columnIndexMap.end()) ? E_ERROR : ret;
+    }
+    return ret;
 }
 
 int AbsResultSet::GetColumnName(int columnIndex, std::string &columnName)
 {
-    int rowCnt = 0;
-    int ret = GetColumnCount(rowCnt);
+    int ret = InitColumnIndex();
     if (ret != E_OK) {
         LOG_ERROR("AbsResultSet::GetColumnName  return GetColumnCount::ret is wrong!");
         return ret;
     }
-    if (columnIndex >= rowCnt || columnIndex < 0) {
+    if (columnIndex >= static_cast<int>(columnNameCache.size()) || columnIndex < 0) {
         return E_INVALID_COLUMN_INDEX;
     }
-    std::vector<std::string> columnNames;
-    GetAllColumnNames(columnNames);
-    columnName = columnNames[columnIndex];
+    columnName = columnNameCache[columnIndex];
     return E_OK;
 }
 
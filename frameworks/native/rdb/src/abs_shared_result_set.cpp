@@ -32,7 +32,12 @@ namespace OHOS {
 namespace NativeRdb {
 AbsSharedResultSet::AbsSharedResultSet(std::string name)
 {
-    AppDataFwk::SharedBlock::Create(name, DEFAULT_BLOCK_SIZE, sharedBlock_);
+    AppDataFwk::SharedBlock::Lease(name, DEFAULT_BLOCK_SIZE, sharedBlock_);
+}
+
+AbsSharedResultSet::AbsSharedResultSet(std::string name, size_t blockSize)
+{
+    AppDataFwk::SharedBlock::Lease(name, blockSize, sharedBlock_);
 }
 
 AbsSharedResultSet::AbsSharedResultSet()
@@ -74,7 +79,7 @@ AppDataFwk::SharedBlock *AbsSharedResultSet::GetBlock() const
 
 int AbsSharedResultSet::GetColumnType(int columnIndex, ColumnType &columnType)
 {
-    AppDataFwk::SharedBlock::CellUnit *cellUnit = sharedBlock_->GetCellUnit((uint32_t)rowPos, (uint32_t)columnIndex);
+    AppDataFwk::SharedBlock::CellUnit *cellUnit = GetCurrentCellUnit(columnIndex);
     if (!cellUnit) {
         LOG_ERROR("AbsSharedResultSet::GetColumnType cellUnit is null!");
         return E_ERROR;
@@ -99,7 +104,7 @@ int AbsSharedResultSet::GoToRow(int position)
         return E_OK;
     }
     bool result = true;
-    if (sharedBlock_ == nullptr || (uint32_t)position >= sharedBlock_->GetRowNum()) {
+    if (!IsRowInBlock(position)) {
         result = OnGo(rowPos, position);
     }
     if (!result) {
@@ -118,7 +123,7 @@ int AbsSharedResultSet::GetBlob(int columnIndex, std::vector<uint8_t> &value)
         return errorCode;
     }
 
-    AppDataFwk::SharedBlock::CellUnit *cellUnit = sharedBlock_->GetCellUnit(rowPos, columnIndex);
+    AppDataFwk::SharedBlock::CellUnit *cellUnit = GetCurrentCellUnit(columnIndex);
     if (!cellUnit) {
         LOG_ERROR("AbsSharedResultSet::GetBlob cellUnit is null!");
         return E_ERROR;
@@ -158,7 +163,7 @@ int AbsSharedResultSet::GetString(int columnIndex, std::string &value)
     if (errorCode != E_OK) {
         return errorCode;
     }
-    AppDataFwk::SharedBlock::CellUnit *cellUnit = sharedBlock_->GetCellUnit(rowPos, columnIndex);
+    AppDataFwk::SharedBlock::CellUnit *cellUnit = GetCurrentCellUnit(columnIndex);
     if (!cellUnit) {
         LOG_ERROR("AbsSharedResultSet::GetString cellUnit is null!");
         return E_ERROR;
@@ -201,7 +206,7 @@ int AbsSharedResultSet::GetInt(int columnIndex, int &value)
     if (errorCode != E_OK) {
         return errorCode;
     }
-    AppDataFwk::SharedBlock::CellUnit *cellUnit = sharedBlock_->GetCellUnit(rowPos, columnIndex);
+    AppDataFwk::SharedBlock::CellUnit *cellUnit = GetCurrentCellUnit(columnIndex);
     if (!cellUnit) {
         LOG_ERROR("AbsSharedResultSet::GetInt cellUnit is null!");
         return E_ERROR;
@@ -216,7 +221,7 @@ int AbsSharedResultSet::GetLong(int columnIndex, int64_t &value)
     if (errorCode != E_OK) {
         return errorCode;
     }
-    AppDataFwk::SharedBlock::CellUnit *cellUnit = sharedBlock_->GetCellUnit(rowPos, columnIndex);
+    AppDataFwk::SharedBlock::CellUnit *cellUnit = GetCurrentCellUnit(columnIndex);
     if (!cellUnit) {
         LOG_ERROR("AbsSharedResultSet::GetLong cellUnit is null!");
         return E_ERROR;
@@ -256,7 +261,7 @@ int AbsSharedResultSet::GetDouble(int columnIndex, double &value)
     if (errorCode != E_OK) {
         return errorCode;
     }
-    AppDataFwk::SharedBlock::CellUnit *cellUnit = sharedBlock_->GetCellUnit(rowPos, columnIndex);
+    AppDataFwk::SharedBlock::CellUnit *cellUnit = GetCurrentCellUnit(columnIndex);
     if (!cellUnit) {
         LOG_ERROR("AbsSharedResultSet::GetDouble cellUnit is null!");
         return E_ERROR;
@@ -288,13 +293,54 @@ int AbsSharedResultSet::GetDouble(int columnIndex, double &value)
     }
 }
 
+int AbsSharedResultSet::SetColumnarColumns(const std::vector<int> &)
+{
+    return E_NOT_SUPPORT;
+}
+
+int AbsSharedResultSet::SetBlockSizeLimits(size_t, size_t)
+{
+    return E_NOT_SUPPORT;
+}
+
+int AbsSharedResultSet::GetBlockStats(BlockStats &) const
+{
+    return E_NOT_SUPPORT;
+}
+
+int AbsSharedResultSet::SetPrefetchNextBlock(bool)
+{
+    return E_NOT_SUPPORT;
+}
+
+int AbsSharedResultSet::GetColumnView(int columnIndex, AppDataFwk::SharedBlock::ColumnView &view)
+{
+    // the row count fills the first block when no row was read yet
+    int rowCnt = 0;
+    GetRowCount(rowCnt);
+    if (sharedBlock_ == nullptr) {
+        LOG_ERROR("AbsSharedResultSet::GetColumnView sharedBlock is null!");
+        return E_ERROR;
+    }
+    int cnt = 0;
+    GetColumnCount(cnt);
+    if (columnIndex >= cnt || columnIndex < 0) {
+        return E_INVALID_COLUMN_INDEX;
+    }
+    if (!sharedBlock_->GetColumnView(static_cast<uint32_t>(columnIndex), view)) {
+        LOG_ERROR("AbsSharedResultSet::GetColumnView column %{public}d is not columnar.", columnIndex);
+        return E_ERROR;
+    }
+    return E_OK;
+}
+
 int AbsSharedResultSet::IsColumnNull(int columnIndex, bool &isNull)
 {
     int errorCode = CheckState(columnIndex);
     if (errorCode != E_OK) {
         return errorCode;
     }
-    AppDataFwk::SharedBlock::CellUnit *cellUnit = sharedBlock_->GetCellUnit(rowPos, columnIndex);
+    AppDataFwk::SharedBlock::CellUnit *cellUnit = GetCurrentCellUnit(columnIndex);
     if (!cellUnit) {
         LOG_ERROR("AbsSharedResultSet::IsColumnNull cellUnit is null!");
         return E_ERROR;
@@ -325,6 +371,16 @@ void AbsSharedResultSet::SetBlock(AppDataFwk::SharedBlock *block)
     }
 }
 
+/**
+ * Replaces the block and hands the previous one back to the caller instead of releasing it.
+ */
+AppDataFwk::SharedBlock *AbsSharedResultSet::ExchangeBlock(AppDataFwk::SharedBlock *block)
+{
+    AppDataFwk::SharedBlock *previous = sharedBlock_;
+    sharedBlock_ = block;
+    return previous;
+}
+
 /**
  * Checks whether an {@code AbsSharedResultSet} object contains shared blocks
  */
@@ -338,7 +394,7 @@ bool AbsSharedResultSet::HasBlock() const
  */
 void AbsSharedResultSet::ClosedBlock()
 {
-    delete sharedBlock_;
+    AppDataFwk::SharedBlock::Release(sharedBlock_);
     sharedBlock_ = nullptr;
 }
 
@@ -376,6 +432,26 @@ int AbsSharedResultSet::CheckState(int columnIndex)
     return E_OK;
 }
 
+/**
+ * Whether the block holds the row, its first row being the row GetStartPos of the result set.
+ */
+bool AbsSharedResultSet::IsRowInBlock(int position) const
+{
+    if (sharedBlock_ == nullptr || position < 0) {
+        return false;
+    }
+    uint32_t startPos = sharedBlock_->GetStartPos();
+    return (uint32_t)position >= startPos && (uint32_t)position - startPos < sharedBlock_->GetRowNum();
+}
+
+AppDataFwk::SharedBlock::CellUnit *AbsSharedResultSet::GetCurrentCellUnit(int columnIndex)
+{
+    if (!IsRowInBlock(rowPos)) {
+        return nullptr;
+    }
+    return sharedBlock_->GetCellUnit((uint32_t)rowPos - sharedBlock_->GetStartPos(), (uint32_t)columnIndex);
+}
+
 bool AbsSharedResultSet::Marshalling(MessageParcel &parcel)
 {
     if (sharedBlock_ == nullptr) {
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "group_commit_queue.h"
+
+#include <algorithm>
+
+#include "rdb_errno.h"
+
+namespace OHOS {
+namespace NativeRdb {
+GroupCommitQueue::GroupCommitQueue(std::chrono::milliseconds window, Executor executor)
+    : window(window), executor(std::move(executor)), hasLeader(false), lastBatchSize(0)
+{
+}
+
+/**
+ * Queues the write and blocks until it has been executed, either by this thread as the leader of a batch
+ * or by another thread leading the batch it was taken into.
+ */
+int GroupCommitQueue::Submit(
+    bool isInsert, int64_t &result, const std::string &sql, const std::vector<ValueObject> &bindArgs)
+{
+    WriteRequest request = { isInsert, &sql, &bindArgs, 0, E_OK, false };
+    std::unique_lock<std::mutex> lock(mutex);
+    pendingRequests.push_back(&request);
+    if (pendingRequests.size() >= MAX_BATCH_SIZE) {
+        condition.notify_all();
+    }
+
+    while (!request.done) {
+        if (hasLeader) {
+            condition.wait(lock);
+            continue;
+        }
+
+        // lead the next batch. Writes queued while the previous batch was running join it right away, a lone
+        // write only waits for the window when the previous batch shows that other writers are active.
+        hasLeader = true;
+        if (pendingRequests.size() == 1 && lastBatchSize > 1) {
+            condition.wait_for(lock, window, [this] { return pendingRequests.size() >= MAX_BATCH_SIZE; });
+        }
+        size_t batchSize = std::min(pendingRequests.size(), MAX_BATCH_SIZE);
+        std::vector<WriteRequest *> batch(pendingRequests.begin(), pendingRequests.begin() + batchSize);
+        pendingRequests.erase(pendingRequests.begin(), pendingRequests.begin() + batchSize);
+        lastBatchSize = batchSize;
+        lock.unlock();
+        executor(batch);
+        lock.lock();
+        for (auto item : batch) {
+            item->done = true;
+        }
+        hasLeader = false;
+        condition.notify_all();
+    }
+
+    result = request.result;
+    return request.errCode;
+}
+} // namespace NativeRdb
+} // namespace OHOS
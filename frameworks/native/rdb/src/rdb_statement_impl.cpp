@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define LOG_TAG "RdbStatementImpl"
+
+#include "rdb_statement_impl.h"
+
+#include "logger.h"
+#include "rdb_errno.h"
+
+namespace OHOS {
+namespace NativeRdb {
+RdbStatementImpl::RdbStatementImpl(std::shared_ptr<RdbStoreImpl> rdb, std::shared_ptr<const PinnedSql> pinnedSql)
+    : rdb(std::move(rdb)), pinnedSql(std::move(pinnedSql))
+{
+    bindArgs.resize(this->pinnedSql->numParameters);
+}
+
+RdbStatementImpl::~RdbStatementImpl()
+{
+}
+
+int RdbStatementImpl::Bind(int index, const ValueObject &value)
+{
+    if (index < 0 || index >= pinnedSql->numParameters) {
+        LOG_ERROR("RdbStatementImpl Bind : index %{public}d out of %{public}d parameters", index,
+            pinnedSql->numParameters);
+        return E_INVALID_BIND_ARGS_COUNT;
+    }
+    bindArgs[index] = value;
+    return E_OK;
+}
+
+int RdbStatementImpl::BindArgs(const std::vector<ValueObject> &bindArgs)
+{
+    if (bindArgs.size() > static_cast<size_t>(pinnedSql->numParameters)) {
+        LOG_ERROR("RdbStatementImpl BindArgs : %{public}zu args for %{public}d parameters", bindArgs.size(),
+            pinnedSql->numParameters);
+        return E_INVALID_BIND_ARGS_COUNT;
+    }
+    // the parameters after the given args are bound to null, as by ClearBindings
+    this->bindArgs = bindArgs;
+    this->bindArgs.resize(pinnedSql->numParameters);
+    return E_OK;
+}
+
+void RdbStatementImpl::ClearBindings()
+{
+    bindArgs.assign(pinnedSql->numParameters, ValueObject());
+}
+
+int RdbStatementImpl::Execute()
+{
+    int64_t outValue = 0;
+    return rdb->ExecutePinned(pinnedSql, bindArgs, PinnedSql::NONE, outValue);
+}
+
+int RdbStatementImpl::ExecuteForLastInsertedRowId(int64_t &outRowId)
+{
+    return rdb->ExecutePinned(pinnedSql, bindArgs, PinnedSql::LAST_INSERTED_ROW_ID, outRowId);
+}
+
+int RdbStatementImpl::ExecuteForChangedRowCount(int64_t &outValue)
+{
+    return rdb->ExecutePinned(pinnedSql, bindArgs, PinnedSql::CHANGED_ROW_COUNT, outValue);
+}
+
+int RdbStatementImpl::ExecuteGetLong(int64_t &outValue)
+{
+    return rdb->ExecutePinned(pinnedSql, bindArgs, PinnedSql::LONG_VALUE, outValue);
+}
+
+std::unique_ptr<AbsSharedResultSet> RdbStatementImpl::Query()
+{
+    // the result set prepares the sql by its text, which finds the statement where an execution pinned it
+    return rdb->QuerySql(pinnedSql->sql, bindArgs);
+}
+
+std::string RdbStatementImpl::GetSql() const
+{
+    return pinnedSql->sql;
+}
+
+int RdbStatementImpl::GetParameterCount() const
+{
+    return pinnedSql->numParameters;
+}
+
+bool RdbStatementImpl::IsReadOnly() const
+{
+    return pinnedSql->isReadOnly;
+}
+} // namespace NativeRdb
+} // namespace OHOS
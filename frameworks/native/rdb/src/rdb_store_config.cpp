@@ -21,6 +21,12 @@
 #include "rdb_errno.h"
 
 namespace OHOS::NativeRdb {
+constexpr int MAX_STATEMENT_CACHE_SIZE = 100;
+constexpr int MAX_READ_CONNECTION_COUNT = 32;
+constexpr int MAX_GROUP_COMMIT_WINDOW = 1000;
+constexpr int MIN_PAGE_SIZE = 512;
+constexpr int MAX_PAGE_SIZE = 65536;
+
 RdbStoreConfig::RdbStoreConfig(const RdbStoreConfig &config)
 {
     name = config.GetName();
@@ -32,6 +38,19 @@ RdbStoreConfig::RdbStoreConfig(const RdbStoreConfig &config)
     readOnly = config.IsReadOnly();
     databaseFileType = config.GetDatabaseFileType();
     databaseFileSecurityLevel = config.GetDatabaseFileSecurityLevel();
+    statementCacheSize_ = config.GetStatementCacheSize();
+    minReadConnectionCount_ = config.GetMinReadConnectionCount();
+    maxReadConnectionCount_ = config.GetMaxReadConnectionCount();
+    readConnectionIdleTimeout_ = config.GetReadConnectionIdleTimeout();
+    connectionAcquireTimeout_ = config.GetConnectionAcquireTimeout();
+    groupCommitWindow_ = config.GetGroupCommitWindow();
+    checkpointPolicy_ = config.GetCheckpointPolicy();
+    checkpointWalPages_ = config.GetCheckpointWalPages();
+    checkpointIdleTime_ = config.GetCheckpointIdleTime();
+    writeConnectionTuning_ = config.GetWriteConnectionTuning();
+    readConnectionTuning_ = config.GetReadConnectionTuning();
+    readConnectionMmap_ = config.IsReadConnectionMmapEnabled();
+    readConnectionMmapSizeLimit_ = config.GetReadConnectionMmapSizeLimit();
 }
 
 RdbStoreConfig::RdbStoreConfig(const std::string &name, StorageMode storageMode, bool isReadOnly,
@@ -248,6 +267,255 @@ std::string RdbStoreConfig::GetEncryptLevel() const
     return encryptLevel_;
 }
 
+/**
+ * Sets the number of prepared statements cached by each connection, 0 disables the cache.
+ */
+int RdbStoreConfig::SetStatementCacheSize(int size)
+{
+    if (size < 0 || size > MAX_STATEMENT_CACHE_SIZE) {
+        LOG_ERROR("statement cache size is invalid: %{public}d", size);
+        return E_ERROR;
+    }
+    statementCacheSize_ = size;
+    return E_OK;
+}
+
+/**
+ * Obtains the statement cache size, -1 while SetStatementCacheSize was not called and the default size is used.
+ */
+int RdbStoreConfig::GetStatementCacheSize() const
+{
+    return statementCacheSize_;
+}
+
+/**
+ * Sets the bounds of the read connection pool. minCount readers stay open, further readers are opened
+ * on demand up to maxCount and closed again after being idle for the idle timeout.
+ */
+int RdbStoreConfig::SetReadConnectionRange(int minCount, int maxCount)
+{
+    if (minCount < 0 || minCount > maxCount || maxCount > MAX_READ_CONNECTION_COUNT) {
+        LOG_ERROR("read connection range is invalid: [%{public}d, %{public}d]", minCount, maxCount);
+        return E_ERROR;
+    }
+    minReadConnectionCount_ = minCount;
+    maxReadConnectionCount_ = maxCount;
+    return E_OK;
+}
+
+/**
+ * Obtains the number of read connections kept open, a negative value means the default is used.
+ */
+int RdbStoreConfig::GetMinReadConnectionCount() const
+{
+    return minReadConnectionCount_;
+}
+
+/**
+ * Obtains the maximum number of read connections, a negative value means the default is used.
+ */
+int RdbStoreConfig::GetMaxReadConnectionCount() const
+{
+    return maxReadConnectionCount_;
+}
+
+/**
+ * Sets how long a read connection above the minimum count may stay idle before it is closed.
+ */
+int RdbStoreConfig::SetReadConnectionIdleTimeout(int milliseconds)
+{
+    if (milliseconds < 0) {
+        LOG_ERROR("read connection idle timeout is invalid: %{public}d", milliseconds);
+        return E_ERROR;
+    }
+    readConnectionIdleTimeout_ = milliseconds;
+    return E_OK;
+}
+
+/**
+ * Obtains the read connection idle timeout in milliseconds, a negative value means the default is used.
+ */
+int RdbStoreConfig::GetReadConnectionIdleTimeout() const
+{
+    return readConnectionIdleTimeout_;
+}
+
+/**
+ * Sets how long an operation waits for a free connection before failing with E_DATABASE_BUSY,
+ * 0 means waiting without a deadline.
+ */
+int RdbStoreConfig::SetConnectionAcquireTimeout(int milliseconds)
+{
+    if (milliseconds < 0) {
+        LOG_ERROR("connection acquire timeout is invalid: %{public}d", milliseconds);
+        return E_ERROR;
+    }
+    connectionAcquireTimeout_ = milliseconds;
+    return E_OK;
+}
+
+/**
+ * Obtains the connection acquire timeout in milliseconds, a negative value means the default is used.
+ */
+int RdbStoreConfig::GetConnectionAcquireTimeout() const
+{
+    return connectionAcquireTimeout_;
+}
+
+/**
+ * Sets how long the first of concurrent single statement writes waits for others to commit together with it,
+ * 0 disables the group commit.
+ */
+int RdbStoreConfig::SetGroupCommitWindow(int milliseconds)
+{
+    if (milliseconds < 0 || milliseconds > MAX_GROUP_COMMIT_WINDOW) {
+        LOG_ERROR("group commit window is invalid: %{public}d", milliseconds);
+        return E_ERROR;
+    }
+    groupCommitWindow_ = milliseconds;
+    return E_OK;
+}
+
+/**
+ * Obtains the group commit window in milliseconds, 0 means the group commit is disabled.
+ */
+int RdbStoreConfig::GetGroupCommitWindow() const
+{
+    return groupCommitWindow_;
+}
+
+/**
+ * Sets who checkpoints the WAL file, the background policies keep checkpoints out of the writes.
+ */
+int RdbStoreConfig::SetCheckpointPolicy(CheckpointPolicy policy)
+{
+    if (policy != CheckpointPolicy::AUTO && policy != CheckpointPolicy::PASSIVE
+        && policy != CheckpointPolicy::TRUNCATE) {
+        LOG_ERROR("checkpoint policy is invalid: %{public}d", static_cast<int>(policy));
+        return E_ERROR;
+    }
+    checkpointPolicy_ = policy;
+    return E_OK;
+}
+
+CheckpointPolicy RdbStoreConfig::GetCheckpointPolicy() const
+{
+    return checkpointPolicy_;
+}
+
+/**
+ * Sets when a background checkpoint runs: as soon as the WAL file holds walPages pages,
+ * or once no write happened for idleMilliseconds.
+ */
+int RdbStoreConfig::SetCheckpointThreshold(int walPages, int idleMilliseconds)
+{
+    if (walPages <= 0 || idleMilliseconds < 0) {
+        LOG_ERROR("checkpoint threshold is invalid: %{public}d, %{public}d", walPages, idleMilliseconds);
+        return E_ERROR;
+    }
+    checkpointWalPages_ = walPages;
+    checkpointIdleTime_ = idleMilliseconds;
+    return E_OK;
+}
+
+/**
+ * Obtains the WAL size in pages starting a background checkpoint, a negative value means the default is used.
+ */
+int RdbStoreConfig::GetCheckpointWalPages() const
+{
+    return checkpointWalPages_;
+}
+
+/**
+ * Obtains the idle time in milliseconds starting a background checkpoint, a negative value means the default is used.
+ */
+int RdbStoreConfig::GetCheckpointIdleTime() const
+{
+    return checkpointIdleTime_;
+}
+
+/**
+ * Sets the SQLite settings of the write connection.
+ */
+int RdbStoreConfig::SetWriteConnectionTuning(const SqliteTuning &tuning)
+{
+    if (!IsValidTuning(tuning)) {
+        return E_ERROR;
+    }
+    writeConnectionTuning_ = tuning;
+    return E_OK;
+}
+
+SqliteTuning RdbStoreConfig::GetWriteConnectionTuning() const
+{
+    return writeConnectionTuning_;
+}
+
+/**
+ * Sets the SQLite settings of the read connections, the write only settings are ignored.
+ */
+int RdbStoreConfig::SetReadConnectionTuning(const SqliteTuning &tuning)
+{
+    if (!IsValidTuning(tuning)) {
+        return E_ERROR;
+    }
+    readConnectionTuning_ = tuning;
+    return E_OK;
+}
+
+SqliteTuning RdbStoreConfig::GetReadConnectionTuning() const
+{
+    return readConnectionTuning_;
+}
+
+/**
+ * Lets the read connections access the database file through memory mapping, up to sizeLimit bytes of it.
+ * An explicit mmapSize of the read connection tuning takes precedence, encrypted databases are never mapped.
+ */
+int RdbStoreConfig::SetReadConnectionMmap(bool enabled, int64_t sizeLimit)
+{
+    if (sizeLimit < -1 || sizeLimit == 0) {
+        LOG_ERROR("mmap size limit is invalid: %{public}lld", static_cast<long long>(sizeLimit));
+        return E_ERROR;
+    }
+    readConnectionMmap_ = enabled;
+    readConnectionMmapSizeLimit_ = sizeLimit;
+    return E_OK;
+}
+
+bool RdbStoreConfig::IsReadConnectionMmapEnabled() const
+{
+    return readConnectionMmap_;
+}
+
+/**
+ * Obtains the mmap size limit of the read connections in bytes, a negative value means the default is used.
+ */
+int64_t RdbStoreConfig::GetReadConnectionMmapSizeLimit() const
+{
+    return readConnectionMmapSizeLimit_;
+}
+
+bool RdbStoreConfig::IsValidTuning(const SqliteTuning &tuning)
+{
+    // the page size is a power of two between 512 and 65536
+    bool isValidPageSize = tuning.pageSize < 0 || (tuning.pageSize >= MIN_PAGE_SIZE
+        && tuning.pageSize <= MAX_PAGE_SIZE && (tuning.pageSize & (tuning.pageSize - 1)) == 0);
+    if (!isValidPageSize || tuning.cacheSize < -1 || tuning.mmapSize < -1 || tuning.journalSizeLimit < -1
+        || tuning.autoCheckpoint < -1) {
+        LOG_ERROR("sqlite tuning is invalid: %{public}d, %{public}d, %{public}lld, %{public}d, %{public}d",
+            tuning.pageSize, tuning.cacheSize, static_cast<long long>(tuning.mmapSize), tuning.journalSizeLimit,
+            tuning.autoCheckpoint);
+        return false;
+    }
+    if (tuning.tempStore != TempStore::DEFAULT && tuning.tempStore != TempStore::FILE
+        && tuning.tempStore != TempStore::MEMORY) {
+        LOG_ERROR("temp store is invalid: %{public}d", static_cast<int>(tuning.tempStore));
+        return false;
+    }
+    return true;
+}
+
 std::string RdbStoreConfig::GetJournalModeValue(JournalMode journalMode)
 {
     std::string value = "";
@@ -25,6 +25,7 @@
 #include "rdb_errno.h"
 #include "rdb_manager.h"
 #include "rdb_perf_trace.h"
+#include "rdb_statement_impl.h"
 #include "relational_store_manager.h"
 #include "sqlite_shared_result_set.h"
 #include "sqlite_sql_builder.h"
@@ -72,6 +73,14 @@ int RdbStoreImpl::InnerOpen(const RdbStoreConfig &config)
     fileType = config.GetDatabaseFileType();
     syncerParam_ = { config.GetBundleName(), config.GetAppModuleName() + '/' + config.GetRelativePath(),
                     RemoveSuffix(config.GetName()), config.GetEncryptLevel(), "", config.GetDistributedType() };
+    if (config.GetGroupCommitWindow() > 0 && !isReadOnly) {
+        groupCommitQueue = std::make_unique<GroupCommitQueue>(std::chrono::milliseconds(config.GetGroupCommitWindow()),
+            [this](std::vector<GroupCommitQueue::WriteRequest *> &batch) {
+                std::shared_ptr<StoreSession> session = GetThreadSession();
+                session->ExecuteGroup(batch);
+                ReleaseThreadSession();
+            });
+    }
     RDB_TRACE_END();
     return E_OK;
 }
@@ -83,42 +92,52 @@ RdbStoreImpl::RdbStoreImpl()
 
 RdbStoreImpl::~RdbStoreImpl()
 {
+    for (auto &shard : sessionShards) {
+        shard.threadMap.clear();
+        shard.idleSessions.clear();
+    }
     delete connectionPool;
-    threadMap.clear();
-    idleSessions.clear();
+}
+
+RdbStoreImpl::SessionShard &RdbStoreImpl::GetSessionShard(std::thread::id tid)
+{
+    return sessionShards[std::hash<std::thread::id>()(tid) % SESSION_SHARD_COUNT];
 }
 
 std::shared_ptr<StoreSession> RdbStoreImpl::GetThreadSession()
 {
     std::thread::id tid = std::this_thread::get_id();
-    std::lock_guard<std::mutex> lock(sessionMutex);
+    SessionShard &shard = GetSessionShard(tid);
+    std::lock_guard<std::mutex> lock(shard.mutex);
 
-    auto iter = threadMap.find(tid);
-    if (iter != threadMap.end()) {
+    auto iter = shard.threadMap.find(tid);
+    if (iter != shard.threadMap.end()) {
         iter->second.second++; // useCount++
         return iter->second.first;
     }
 
     // get from idle stack
     std::shared_ptr<StoreSession> session;
-    if (idleSessions.empty()) {
+    if (shard.idleSessions.empty()) {
         session = std::make_shared<StoreSession>(*connectionPool);
     } else {
-        session = idleSessions.back();
-        idleSessions.pop_back();
+        session = std::move(shard.idleSessions.back());
+        shard.idleSessions.pop_back();
+        idleSessionCount--;
     }
 
-    threadMap.insert(std::make_pair(tid, std::make_pair(session, 1))); // useCount is 1
+    shard.threadMap.emplace(tid, std::make_pair(session, 1)); // useCount is 1
     return session;
 }
 
 void RdbStoreImpl::ReleaseThreadSession()
 {
     std::thread::id tid = std::this_thread::get_id();
-    std::lock_guard<std::mutex> lock(sessionMutex);
+    SessionShard &shard = GetSessionShard(tid);
+    std::lock_guard<std::mutex> lock(shard.mutex);
 
-    auto iter = threadMap.find(tid);
-    if (iter == threadMap.end()) {
+    auto iter = shard.threadMap.find(tid);
+    if (iter == shard.threadMap.end()) {
         LOG_ERROR("RdbStoreImpl ReleaseThreadSession: no session found for the current thread");
         return;
     }
@@ -128,10 +147,13 @@ void RdbStoreImpl::ReleaseThreadSession()
         return;
     }
 
-    if (idleSessions.size() < MAX_IDLE_SESSION_SIZE) {
-        idleSessions.push_back(iter->second.first);
+    // the cap holds for the store, not for each shard
+    if (idleSessionCount.fetch_add(1) < MAX_IDLE_SESSION_SIZE) {
+        shard.idleSessions.push_back(std::move(iter->second.first));
+    } else {
+        idleSessionCount--;
     }
-    threadMap.erase(iter);
+    shard.threadMap.erase(iter);
 }
 
 int RdbStoreImpl::Insert(int64_t &outRowId, const std::string &table, const ValuesBucket &initialValues)
@@ -163,26 +185,131 @@ int RdbStoreImpl::InsertWithConflictResolution(int64_t &outRowId, const std::str
         return errCode;
     }
 
-    std::stringstream sql;
-    sql << "INSERT" << conflictClause << " INTO " << table << '(';
+    std::vector<ValueObject> bindArgs;
+    std::shared_ptr<const std::string> sql = GetWriteSql(true, table, conflictClause, initialValues, bindArgs);
+    errCode = ExecuteWrite(true, outRowId, *sql, bindArgs, conflictResolution);
+    RDB_TRACE_END();
+    return errCode;
+}
+
+/**
+ * Inserts a batch of rows in one transaction. Rows are grouped by their column set so that every
+ * distinct INSERT statement is prepared once and rebound for each row of its group.
+ */
+int RdbStoreImpl::BatchInsert(int64_t &outInsertNum, const std::string &table,
+    const std::vector<ValuesBucket> &values)
+{
+    outInsertNum = 0;
+    if (table.empty()) {
+        return E_EMPTY_TABLE_NAME;
+    }
+
+    if (values.empty()) {
+        return E_OK;
+    }
 
-    std::map<std::string, ValueObject> valuesMap;
-    initialValues.GetAll(valuesMap);
+    RDB_TRACE_BEGIN("rdb batch insert");
+    StoreSession::BatchSqls batch;
+    std::map<std::string, size_t> batchIndex;
+    for (const auto &bucket : values) {
+        if (bucket.IsEmpty()) {
+            RDB_TRACE_END();
+            return E_EMPTY_VALUES_BUCKET;
+        }
+
+        // grouped by the sql, which has one placeholder for each column even when a name holds a comma
+        std::vector<ValueObject> bindArgs;
+        std::shared_ptr<const std::string> sql = GetWriteSql(true, table, "", bucket, bindArgs);
+        auto iter = batchIndex.find(*sql);
+        if (iter == batchIndex.end()) {
+            iter = batchIndex.emplace(*sql, batch.size()).first;
+            batch.emplace_back(*sql, std::vector<std::vector<ValueObject>>());
+        }
+        batch[iter->second].second.push_back(std::move(bindArgs));
+    }
+
+    std::shared_ptr<StoreSession> session = GetThreadSession();
+    int errCode = session->ExecuteBatch(outInsertNum, batch);
+    ReleaseThreadSession();
+    RDB_TRACE_END();
+    return errCode;
+}
+
+int RdbStoreImpl::Upsert(int64_t &outChangedRows, const std::string &table, const ValuesBucket &values,
+    const std::vector<std::string> &conflictColumns, const std::vector<std::string> &updateColumns)
+{
+    if (table.empty()) {
+        return E_EMPTY_TABLE_NAME;
+    }
+
+    if (values.IsEmpty()) {
+        return E_EMPTY_VALUES_BUCKET;
+    }
+
+    if (conflictColumns.empty()) {
+        return E_INVALID_COLUMN_NAME;
+    }
+
+    RDB_TRACE_BEGIN("rdb upsert");
     std::vector<ValueObject> bindArgs;
-    for (auto iter = valuesMap.begin(); iter != valuesMap.end(); iter++) {
-        sql << ((iter == valuesMap.begin()) ? "" : ",");
-        sql << iter->first;               // columnName
-        bindArgs.push_back(iter->second); // columnValue
+    std::shared_ptr<const std::string> sql = GetUpsertSql(table, values, conflictColumns, updateColumns, bindArgs);
+    if (sql == nullptr) {
+        RDB_TRACE_END();
+        return E_INVALID_COLUMN_NAME;
+    }
+    int errCode = ExecuteWrite(false, outChangedRows, *sql, bindArgs, ConflictResolution::ON_CONFLICT_NONE);
+    RDB_TRACE_END();
+    return errCode;
+}
+
+/**
+ * Upserts a batch of rows in one transaction, preparing the upsert of each distinct column set once as
+ * BatchInsert does.
+ */
+int RdbStoreImpl::BatchUpsert(int64_t &outChangedRows, const std::string &table,
+    const std::vector<ValuesBucket> &values, const std::vector<std::string> &conflictColumns,
+    const std::vector<std::string> &updateColumns)
+{
+    outChangedRows = 0;
+    if (table.empty()) {
+        return E_EMPTY_TABLE_NAME;
+    }
+
+    if (conflictColumns.empty()) {
+        return E_INVALID_COLUMN_NAME;
+    }
+
+    if (values.empty()) {
+        return E_OK;
     }
 
-    sql << ") VALUES (";
-    for (size_t i = 0; i < valuesMap.size(); i++) {
-        sql << ((i == 0) ? "?" : ",?");
+    RDB_TRACE_BEGIN("rdb batch upsert");
+    StoreSession::BatchSqls batch;
+    std::map<std::string, size_t> batchIndex;
+    for (const auto &bucket : values) {
+        if (bucket.IsEmpty()) {
+            RDB_TRACE_END();
+            return E_EMPTY_VALUES_BUCKET;
+        }
+
+        std::vector<ValueObject> bindArgs;
+        std::shared_ptr<const std::string> sql =
+            GetUpsertSql(table, bucket, conflictColumns, updateColumns, bindArgs);
+        if (sql == nullptr) {
+            RDB_TRACE_END();
+            return E_INVALID_COLUMN_NAME;
+        }
+
+        auto iter = batchIndex.find(*sql);
+        if (iter == batchIndex.end()) {
+            iter = batchIndex.emplace(*sql, batch.size()).first;
+            batch.emplace_back(*sql, std::vector<std::vector<ValueObject>>());
+        }
+        batch[iter->second].second.push_back(std::move(bindArgs));
     }
-    sql << ')';
 
     std::shared_ptr<StoreSession> session = GetThreadSession();
-    errCode = session->ExecuteForLastInsertedRowId(outRowId, sql.str(), bindArgs);
+    int errCode = session->ExecuteBatch(outChangedRows, batch);
     ReleaseThreadSession();
     RDB_TRACE_END();
     return errCode;
@@ -190,19 +317,33 @@ int RdbStoreImpl::InsertWithConflictResolution(int64_t &outRowId, const std::str
 
 int RdbStoreImpl::Update(int &changedRows, const std::string &table, const ValuesBucket &values,
     const std::string &whereClause, const std::vector<std::string> &whereArgs)
+{
+    return UpdateWithConflictResolution(changedRows, table, values, whereClause,
+        SqliteSqlBuilder::ToValueObjects(whereArgs), ConflictResolution::ON_CONFLICT_NONE);
+}
+
+int RdbStoreImpl::Update(int &changedRows, const std::string &table, const ValuesBucket &values,
+    const std::string &whereClause, const std::vector<ValueObject> &bindArgs)
 {
     return UpdateWithConflictResolution(
-        changedRows, table, values, whereClause, whereArgs, ConflictResolution::ON_CONFLICT_NONE);
+        changedRows, table, values, whereClause, bindArgs, ConflictResolution::ON_CONFLICT_NONE);
 }
 
 int RdbStoreImpl::Update(int &changedRows, const ValuesBucket &values, const AbsRdbPredicates &predicates)
 {
     return Update(
-        changedRows, predicates.GetTableName(), values, predicates.GetWhereClause(), predicates.GetWhereArgs());
+        changedRows, predicates.GetTableName(), values, predicates.GetWhereClause(), predicates.GetBindArgs());
 }
 
 int RdbStoreImpl::UpdateWithConflictResolution(int &changedRows, const std::string &table, const ValuesBucket &values,
     const std::string &whereClause, const std::vector<std::string> &whereArgs, ConflictResolution conflictResolution)
+{
+    return UpdateWithConflictResolution(
+        changedRows, table, values, whereClause, SqliteSqlBuilder::ToValueObjects(whereArgs), conflictResolution);
+}
+
+int RdbStoreImpl::UpdateWithConflictResolution(int &changedRows, const std::string &table, const ValuesBucket &values,
+    const std::string &whereClause, const std::vector<ValueObject> &whereArgs, ConflictResolution conflictResolution)
 {
     if (table.empty()) {
         return E_EMPTY_TABLE_NAME;
@@ -220,40 +361,249 @@ int RdbStoreImpl::UpdateWithConflictResolution(int &changedRows, const std::stri
         return errCode;
     }
 
-    std::stringstream sql;
-    sql << "UPDATE" << conflictClause << " " << table << " SET ";
-
-    std::map<std::string, ValueObject> valuesMap;
-    values.GetAll(valuesMap);
     std::vector<ValueObject> bindArgs;
-    for (auto iter = valuesMap.begin(); iter != valuesMap.end(); iter++) {
-        sql << ((iter == valuesMap.begin()) ? "" : ",");
-        sql << iter->first << "=?";       // columnName
-        bindArgs.push_back(iter->second); // columnValue
+    bindArgs.reserve(values.Size() + whereArgs.size());
+    std::shared_ptr<const std::string> updateSql = GetWriteSql(false, table, conflictClause, values, bindArgs);
+    const std::string *sql = updateSql.get();
+    std::string sqlWithWhere;
+    if (!whereClause.empty()) {
+        sqlWithWhere.append(*updateSql).append(" WHERE ").append(whereClause);
+        sql = &sqlWithWhere;
     }
+    bindArgs.insert(bindArgs.end(), whereArgs.begin(), whereArgs.end());
 
-    if (whereClause.empty() == false) {
-        sql << " WHERE " << whereClause;
+    int64_t result = 0;
+    errCode = ExecuteWrite(false, result, *sql, bindArgs, conflictResolution);
+    changedRows = static_cast<int>(result);
+    RDB_TRACE_END();
+    return errCode;
+}
+
+/**
+ * Appends a name to a write sql key with its length in front, as names may hold any character once quoted.
+ */
+static void AppendKeyPart(std::string &key, const std::string &part)
+{
+    key.append(std::to_string(part.size())).append(":").append(part);
+}
+
+static void AppendKeyParts(std::string &key, const std::vector<std::string> &parts)
+{
+    key.append(std::to_string(parts.size())).append(";");
+    for (const auto &part : parts) {
+        AppendKeyPart(key, part);
+    }
+}
+
+/**
+ * Obtains the INSERT sql, or the UPDATE sql up to its SET clause, for the columns of values and appends the values
+ * to bindArgs in the order of the columns. The sql is generated once for each table, conflict clause and column set.
+ */
+std::shared_ptr<const std::string> RdbStoreImpl::GetWriteSql(bool isInsert, const std::string &table,
+    const std::string &conflictClause, const ValuesBucket &values, std::vector<ValueObject> &bindArgs)
+{
+    std::string key(isInsert ? "I" : "U");
+    AppendKeyPart(key, conflictClause);
+    AppendKeyPart(key, table);
+    bindArgs.reserve(bindArgs.size() + values.Size());
+    values.ForEach([&key, &bindArgs](const std::string &column, const ValueObject &value) {
+        AppendKeyPart(key, column);
+        bindArgs.push_back(value);
+    });
+    std::shared_ptr<const std::string> writeSql = FindWriteSql(key);
+    if (writeSql != nullptr) {
+        return writeSql;
+    }
+
+    std::string sql(isInsert ? "INSERT" : "UPDATE");
+    std::string placeholders;
+    sql.append(conflictClause).append(isInsert ? " INTO " : " ").append(table).append(isInsert ? "(" : " SET ");
+    bool isFirst = true;
+    values.ForEach([isInsert, &isFirst, &sql, &placeholders](const std::string &column, const ValueObject &) {
+        sql.append(isFirst ? "" : ",").append(column).append(isInsert ? "" : "=?");
+        placeholders.append(isFirst ? "?" : ",?");
+        isFirst = false;
+    });
+    if (isInsert) {
+        sql.append(") VALUES (").append(placeholders).append(")");
+    }
+    return CacheWriteSql(std::move(key), std::move(sql));
+}
+
+/**
+ * Obtains the upsert sql for the columns of values as GetWriteSql does, or nullptr if one of updateColumns is not
+ * a column of values.
+ */
+std::shared_ptr<const std::string> RdbStoreImpl::GetUpsertSql(const std::string &table, const ValuesBucket &values,
+    const std::vector<std::string> &conflictColumns, const std::vector<std::string> &updateColumns,
+    std::vector<ValueObject> &bindArgs)
+{
+    std::string key("P");
+    AppendKeyPart(key, table);
+    AppendKeyParts(key, conflictColumns);
+    AppendKeyParts(key, updateColumns);
+    size_t argCount = bindArgs.size();
+    bindArgs.reserve(argCount + values.Size());
+    values.ForEach([&key, &bindArgs](const std::string &column, const ValueObject &value) {
+        AppendKeyPart(key, column);
+        bindArgs.push_back(value);
+    });
+    std::shared_ptr<const std::string> writeSql = FindWriteSql(key);
+    if (writeSql != nullptr) {
+        return writeSql;
+    }
+
+    std::vector<ValueObject> builtArgs;
+    std::string sql = SqliteSqlBuilder::BuildUpsertString(values, table, conflictColumns, updateColumns, builtArgs);
+    if (sql.empty()) {
+        bindArgs.resize(argCount);
+        return nullptr;
+    }
+    return CacheWriteSql(std::move(key), std::move(sql));
+}
+
+std::shared_ptr<const std::string> RdbStoreImpl::FindWriteSql(const std::string &key)
+{
+    std::lock_guard<std::mutex> lock(writeSqlMutex);
+    auto it = writeSqls.find(key);
+    return (it != writeSqls.end()) ? it->second : nullptr;
+}
+
+std::shared_ptr<const std::string> RdbStoreImpl::CacheWriteSql(std::string key, std::string sql)
+{
+    auto writeSql = std::make_shared<const std::string>(std::move(sql));
+    std::lock_guard<std::mutex> lock(writeSqlMutex);
+    if (writeSqls.size() >= MAX_WRITE_SQL_COUNT) {
+        writeSqls.clear();
+    }
+    writeSqls.emplace(std::move(key), writeSql);
+    return writeSql;
+}
+
+/**
+ * Executes a single statement write, through the group commit queue when it is enabled and the write does not
+ * belong to a transaction or a connection already held by the current thread.
+ */
+int RdbStoreImpl::ExecuteWrite(bool isInsert, int64_t &result, const std::string &sql,
+    const std::vector<ValueObject> &bindArgs, ConflictResolution conflictResolution)
+{
+    std::shared_ptr<StoreSession> session = GetThreadSession();
+    int errCode = E_OK;
+    if (groupCommitQueue == nullptr || conflictResolution == ConflictResolution::ON_CONFLICT_ROLLBACK ||
+        session->IsHoldingConnection() || session->IsInTransaction()) {
+        if (isInsert) {
+            errCode = session->ExecuteForLastInsertedRowId(result, sql, bindArgs);
+        } else {
+            int changedRows = 0;
+            errCode = session->ExecuteForChangedRowCount(changedRows, sql, bindArgs);
+            result = changedRows;
+        }
+    } else {
+        errCode = groupCommitQueue->Submit(isInsert, result, sql, bindArgs);
+    }
+    ReleaseThreadSession();
+    return errCode;
+}
+
+int RdbStoreImpl::Delete(int &deletedRows, const AbsRdbPredicates &predicates)
+{
+    return Delete(deletedRows, predicates.GetTableName(), predicates.GetWhereClause(), predicates.GetBindArgs());
+}
+
+/**
+ * Appends one item to the batch, sharing the entry of the previous item when both have the same sql. Items stay in
+ * their order, and the statement of a sql that comes back later is found in the statement cache of the connection.
+ */
+static void AppendToBatch(StoreSession::BatchSqls &batch, std::string sql, std::vector<ValueObject> bindArgs)
+{
+    if (batch.empty() || batch.back().first != sql) {
+        batch.emplace_back(std::move(sql), std::vector<std::vector<ValueObject>>());
     }
+    batch.back().second.push_back(std::move(bindArgs));
+}
 
-    for (auto &iter : whereArgs) {
-        bindArgs.push_back(ValueObject(iter));
+int RdbStoreImpl::BatchUpdate(std::vector<int64_t> &changedRows,
+    const std::vector<std::pair<ValuesBucket, AbsRdbPredicates>> &updates)
+{
+    changedRows.clear();
+    if (updates.empty()) {
+        return E_OK;
     }
 
+    RDB_TRACE_BEGIN("rdb batch update");
+    StoreSession::BatchSqls batch;
+    for (const auto &[values, predicates] : updates) {
+        std::string table = predicates.GetTableName();
+        if (table.empty()) {
+            RDB_TRACE_END();
+            return E_EMPTY_TABLE_NAME;
+        }
+
+        if (values.IsEmpty()) {
+            RDB_TRACE_END();
+            return E_EMPTY_VALUES_BUCKET;
+        }
+
+        std::vector<ValueObject> whereArgs = predicates.GetBindArgs();
+        std::vector<ValueObject> bindArgs;
+        bindArgs.reserve(values.Size() + whereArgs.size());
+        std::string sql = *GetWriteSql(false, table, "", values, bindArgs);
+        std::string whereClause = predicates.GetWhereClause();
+        if (!whereClause.empty()) {
+            sql.append(" WHERE ").append(whereClause);
+        }
+        bindArgs.insert(bindArgs.end(), whereArgs.begin(), whereArgs.end());
+        AppendToBatch(batch, std::move(sql), std::move(bindArgs));
+    }
+
+    int64_t totalChanges = 0;
     std::shared_ptr<StoreSession> session = GetThreadSession();
-    errCode = session->ExecuteForChangedRowCount(changedRows, sql.str(), bindArgs);
+    int errCode = session->ExecuteBatch(totalChanges, batch, &changedRows);
     ReleaseThreadSession();
     RDB_TRACE_END();
     return errCode;
 }
 
-int RdbStoreImpl::Delete(int &deletedRows, const AbsRdbPredicates &predicates)
+int RdbStoreImpl::BatchDelete(std::vector<int64_t> &deletedRows, const std::vector<AbsRdbPredicates> &predicates)
 {
-    return Delete(deletedRows, predicates.GetTableName(), predicates.GetWhereClause(), predicates.GetWhereArgs());
+    deletedRows.clear();
+    if (predicates.empty()) {
+        return E_OK;
+    }
+
+    RDB_TRACE_BEGIN("rdb batch delete");
+    StoreSession::BatchSqls batch;
+    for (const auto &item : predicates) {
+        std::string table = item.GetTableName();
+        if (table.empty()) {
+            RDB_TRACE_END();
+            return E_EMPTY_TABLE_NAME;
+        }
+
+        std::string sql = "DELETE FROM " + table;
+        std::string whereClause = item.GetWhereClause();
+        if (!whereClause.empty()) {
+            sql.append(" WHERE ").append(whereClause);
+        }
+        AppendToBatch(batch, std::move(sql), item.GetBindArgs());
+    }
+
+    int64_t totalChanges = 0;
+    std::shared_ptr<StoreSession> session = GetThreadSession();
+    int errCode = session->ExecuteBatch(totalChanges, batch, &deletedRows);
+    ReleaseThreadSession();
+    RDB_TRACE_END();
+    return errCode;
 }
 
 int RdbStoreImpl::Delete(int &deletedRows, const std::string &table, const std::string &whereClause,
     const std::vector<std::string> &whereArgs)
+{
+    return Delete(deletedRows, table, whereClause, SqliteSqlBuilder::ToValueObjects(whereArgs));
+}
+
+int RdbStoreImpl::Delete(int &deletedRows, const std::string &table, const std::string &whereClause,
+    const std::vector<ValueObject> &bindArgs)
 {
     if (table.empty()) {
         return E_EMPTY_TABLE_NAME;
@@ -266,14 +616,9 @@ int RdbStoreImpl::Delete(int &deletedRows, const std::string &table, const std::
         sql << " WHERE " << whereClause;
     }
 
-    std::vector<ValueObject> bindArgs;
-    for (auto &iter : whereArgs) {
-        bindArgs.push_back(ValueObject(iter));
-    }
-
-    std::shared_ptr<StoreSession> session = GetThreadSession();
-    int errCode = session->ExecuteForChangedRowCount(deletedRows, sql.str(), bindArgs);
-    ReleaseThreadSession();
+    int64_t result = 0;
+    int errCode = ExecuteWrite(false, result, sql.str(), bindArgs, ConflictResolution::ON_CONFLICT_NONE);
+    deletedRows = static_cast<int>(result);
     RDB_TRACE_END();
     return errCode;
 }
@@ -282,9 +627,8 @@ std::unique_ptr<AbsSharedResultSet> RdbStoreImpl::Query(
     const AbsRdbPredicates &predicates, const std::vector<std::string> columns)
 {
     LOG_DEBUG("RdbStoreImpl::Query on called.");
-    std::vector<std::string> selectionArgs = predicates.GetWhereArgs();
     std::string sql = SqliteSqlBuilder::BuildQueryString(predicates, columns);
-    return QuerySql(sql, selectionArgs);
+    return QuerySql(sql, predicates.GetBindArgs());
 }
 
 std::unique_ptr<AbsSharedResultSet> RdbStoreImpl::Query(int &errCode, bool distinct, const std::string &table,
@@ -308,9 +652,15 @@ std::unique_ptr<AbsSharedResultSet> RdbStoreImpl::Query(int &errCode, bool disti
 
 std::unique_ptr<AbsSharedResultSet> RdbStoreImpl::QuerySql(const std::string &sql,
     const std::vector<std::string> &selectionArgs)
+{
+    return QuerySql(sql, SqliteSqlBuilder::ToValueObjects(selectionArgs));
+}
+
+std::unique_ptr<AbsSharedResultSet> RdbStoreImpl::QuerySql(const std::string &sql,
+    const std::vector<ValueObject> &bindArgs)
 {
     RDB_TRACE_BEGIN("rdb query sql");
-    auto resultSet = std::make_unique<SqliteSharedResultSet>(shared_from_this(), path, sql, selectionArgs);
+    auto resultSet = std::make_unique<SqliteSharedResultSet>(shared_from_this(), path, sql, bindArgs);
     RDB_TRACE_END();
     return resultSet;
 }
@@ -318,16 +668,8 @@ std::unique_ptr<AbsSharedResultSet> RdbStoreImpl::QuerySql(const std::string &sq
 int RdbStoreImpl::Count(int64_t &outValue, const AbsRdbPredicates &predicates)
 {
     LOG_DEBUG("RdbStoreImpl::Count on called.");
-    std::vector<std::string> selectionArgs = predicates.GetWhereArgs();
     std::string sql = SqliteSqlBuilder::BuildCountString(predicates);
-
-    std::vector<ValueObject> bindArgs;
-    std::vector<std::string> whereArgs = predicates.GetWhereArgs();
-    for (const auto& whereArg : whereArgs) {
-        bindArgs.emplace_back(whereArg);
-    }
-
-    return ExecuteAndGetLong(outValue, sql, bindArgs);
+    return ExecuteAndGetLong(outValue, sql, predicates.GetBindArgs());
 }
 
 int RdbStoreImpl::ExecuteSql(const std::string &sql, const std::vector<ValueObject> &bindArgs)
@@ -346,7 +688,7 @@ int RdbStoreImpl::ExecuteSql(const std::string &sql, const std::vector<ValueObje
     }
     int sqlType = SqliteUtils::GetSqlStatementType(sql);
     if (sqlType == SqliteUtils::STATEMENT_DDL) {
-        errCode = connectionPool->ReOpenAvailableReadConnections();
+        connectionPool->NotifySchemaChanged();
     }
     ReleaseThreadSession();
     return errCode;
@@ -389,6 +731,36 @@ int RdbStoreImpl::ExecuteForChangedRowCount(int64_t &outValue, const std::string
     return errCode;
 }
 
+std::shared_ptr<RdbStatement> RdbStoreImpl::Prepare(int &errCode, const std::string &sql)
+{
+    auto pinnedSql = std::make_shared<PinnedSql>();
+    pinnedSql->sql = sql;
+    pinnedSql->type = SqliteUtils::GetSqlStatementType(sql);
+    if (pinnedSql->type == SqliteUtils::STATEMENT_ATTACH) {
+        LOG_ERROR("RdbStoreImpl Prepare : attach must be executed by Attach or ExecuteSql");
+        errCode = E_NOT_SUPPORT;
+        return nullptr;
+    }
+    std::vector<std::string> columnNames;
+    errCode = PrepareAndGetInfo(sql, pinnedSql->isReadOnly, pinnedSql->numParameters, columnNames);
+    if (errCode != E_OK) {
+        return nullptr;
+    }
+    return std::make_shared<RdbStatementImpl>(shared_from_this(), pinnedSql);
+}
+
+int RdbStoreImpl::ExecutePinned(const std::shared_ptr<const PinnedSql> &pinnedSql,
+    const std::vector<ValueObject> &bindArgs, PinnedSql::ResultType resultType, int64_t &outValue)
+{
+    std::shared_ptr<StoreSession> session = GetThreadSession();
+    int errCode = session->ExecutePinned(pinnedSql, bindArgs, resultType, outValue);
+    if (errCode == E_OK && pinnedSql->type == SqliteUtils::STATEMENT_DDL) {
+        connectionPool->NotifySchemaChanged();
+    }
+    ReleaseThreadSession();
+    return errCode;
+}
+
 /**
  * Restores a database from a specified encrypted or unencrypted database file.
  */
@@ -553,7 +925,7 @@ int RdbStoreImpl::ChangeEncryptKey(const std::vector<uint8_t> &newKey)
 }
 
 std::shared_ptr<SqliteStatement> RdbStoreImpl::BeginStepQuery(
-    int &errCode, const std::string sql, const std::vector<std::string> &bindArgs)
+    int &errCode, const std::string sql, const std::vector<ValueObject> &bindArgs)
 {
     std::shared_ptr<StoreSession> session = GetThreadSession();
     LOG_DEBUG("session connection count:%{public}d", session->GetConnectionUseCount());
@@ -638,6 +1010,47 @@ std::string RdbStoreImpl::GetFileSecurityLevel()
     return fileSecurityLevel;
 }
 
+/**
+ * Obtains the prepared statement cache hit and miss counts of all connections.
+ */
+void RdbStoreImpl::GetStatementCacheStats(uint64_t &hits, uint64_t &misses)
+{
+    connectionPool->GetStatementCacheStats(hits, misses);
+}
+
+void RdbStoreImpl::GetReadConnectionCount(int &total, int &idle)
+{
+    connectionPool->GetReadConnectionCount(total, idle);
+}
+
+bool RdbStoreImpl::ReservePrefetchConnection()
+{
+    return connectionPool->ReservePrefetchConnection();
+}
+
+void RdbStoreImpl::ReleasePrefetchConnection()
+{
+    connectionPool->ReleasePrefetchConnection();
+}
+
+/**
+ * Obtains the number of sessions kept for reuse by threads that use the store next.
+ */
+int RdbStoreImpl::GetIdleSessionCount() const
+{
+    return idleSessionCount;
+}
+
+void RdbStoreImpl::GetConnectionPoolStats(ConnectionPoolStats &writeStats, ConnectionPoolStats &readStats)
+{
+    connectionPool->GetConnectionPoolStats(writeStats, readStats);
+}
+
+void RdbStoreImpl::GetCheckpointStats(CheckpointStats &stats)
+{
+    connectionPool->GetCheckpointStats(stats);
+}
+
 int RdbStoreImpl::PrepareAndGetInfo(const std::string &sql, bool &outIsReadOnly, int &numParameters,
     std::vector<std::string> &columnNames)
 {
@@ -733,9 +1146,15 @@ int RdbStoreImpl::ExecuteForSharedBlock(int &rowNum, AppDataFwk::SharedBlock *sh
  */
 std::unique_ptr<ResultSet> RdbStoreImpl::QueryByStep(const std::string &sql,
     const std::vector<std::string> &selectionArgs)
+{
+    return QueryByStep(sql, SqliteSqlBuilder::ToValueObjects(selectionArgs));
+}
+
+std::unique_ptr<ResultSet> RdbStoreImpl::QueryByStep(const std::string &sql,
+    const std::vector<ValueObject> &bindArgs)
 {
     std::unique_ptr<ResultSet> resultSet =
-        std::make_unique<StepResultSet>(shared_from_this(), sql, selectionArgs);
+        std::make_unique<StepResultSet>(shared_from_this(), sql, bindArgs);
     return resultSet;
 }
 
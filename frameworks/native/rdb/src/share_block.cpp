@@ -176,6 +176,40 @@ void FillSharedBlock(SharedBlockInfo *info)
     }
 }
 
+/**
+ * Fills the block from a statement kept positioned between fills, starting with its current row when hasRow is
+ * set. When the block is full, isFull is set and the current row of the statement is left for the next fill.
+ */
+void FillSharedBlockStep(SharedBlockInfo *info, bool hasRow)
+{
+    int retryCount = 0;
+    info->addedRows = 0;
+    info->requiredPos = info->startPos;
+    info->isFull = false;
+    info->hasException = false;
+    while (!info->isFull && !info->hasException) {
+        int err = hasRow ? SQLITE_ROW : sqlite3_step(info->statement);
+        hasRow = false;
+        if (err == SQLITE_ROW) {
+            retryCount = 0;
+            FillRow(info);
+        } else if (err == SQLITE_DONE) {
+            break;
+        } else if (err == SQLITE_LOCKED || err == SQLITE_BUSY) {
+            LOG_ERROR("Database locked, retrying");
+            if (retryCount > RETRY_TIME) {
+                LOG_ERROR("Bailing on database busy retry");
+                info->hasException = true;
+            } else {
+                usleep(SLEEP_TIME);
+                retryCount++;
+            }
+        } else {
+            info->hasException = true;
+        }
+    }
+}
+
 void FillRow(SharedBlockInfo *info)
 {
     FillOneRowResult fillOneRowResult =
@@ -14,6 +14,9 @@
  */
 
 #include "sqlite_config.h"
+
+#include <algorithm>
+
 #include "sqlite_global_config.h"
 
 namespace OHOS {
@@ -32,6 +35,68 @@ SqliteConfig::SqliteConfig(const RdbStoreConfig &config)
     if (journalMode.empty()) {
         journalMode = SqliteGlobalConfig::GetDefaultJournalMode();
     }
+    statementCacheSize = config.GetStatementCacheSize();
+    if (statementCacheSize < 0) {
+        statementCacheSize = SqliteGlobalConfig::GetStatementCacheSize();
+    }
+    maxReadConnectionCount = config.GetMaxReadConnectionCount();
+    if (maxReadConnectionCount < 0) {
+        maxReadConnectionCount = SqliteGlobalConfig::GetReadConnectionCount();
+    }
+    minReadConnectionCount = config.GetMinReadConnectionCount();
+    if (minReadConnectionCount < 0) {
+        minReadConnectionCount = std::min(SqliteGlobalConfig::GetMinReadConnectionCount(), maxReadConnectionCount);
+    }
+    readConnectionIdleTimeout = config.GetReadConnectionIdleTimeout();
+    if (readConnectionIdleTimeout < 0) {
+        readConnectionIdleTimeout = SqliteGlobalConfig::GetReadConnectionIdleTimeout();
+    }
+    connectionAcquireTimeout = config.GetConnectionAcquireTimeout();
+    if (connectionAcquireTimeout < 0) {
+        connectionAcquireTimeout = SqliteGlobalConfig::GetConnectionAcquireTimeout();
+    }
+    checkpointPolicy = config.GetCheckpointPolicy();
+    checkpointWalPages = config.GetCheckpointWalPages();
+    if (checkpointWalPages <= 0) {
+        checkpointWalPages = SqliteGlobalConfig::GetCheckpointWalPages();
+    }
+    checkpointIdleTime = config.GetCheckpointIdleTime();
+    if (checkpointIdleTime < 0) {
+        checkpointIdleTime = SqliteGlobalConfig::GetCheckpointIdleTime();
+    }
+    writeTuning = ResolveTuning(config.GetWriteConnectionTuning(), true);
+    SqliteTuning readConnectionTuning = config.GetReadConnectionTuning();
+    if (config.IsReadConnectionMmapEnabled() && readConnectionTuning.mmapSize < 0) {
+        readConnectionTuning.mmapSize = config.GetReadConnectionMmapSizeLimit();
+        if (readConnectionTuning.mmapSize < 0) {
+            readConnectionTuning.mmapSize = SqliteGlobalConfig::GetReadMmapSizeLimit();
+        }
+    }
+    readTuning = ResolveTuning(readConnectionTuning, false);
+}
+
+/**
+ * Replaces the unset settings by the defaults of the connection kind.
+ */
+SqliteTuning SqliteConfig::ResolveTuning(const SqliteTuning &tuning, bool isWriteConnection)
+{
+    SqliteTuning resolved = tuning;
+    if (resolved.pageSize < 0) {
+        resolved.pageSize = SqliteGlobalConfig::GetPageSize();
+    }
+    if (resolved.cacheSize < 0) {
+        resolved.cacheSize = SqliteGlobalConfig::GetCacheSize(isWriteConnection);
+    }
+    if (resolved.mmapSize < 0) {
+        resolved.mmapSize = SqliteGlobalConfig::GetMmapSize(isWriteConnection);
+    }
+    if (resolved.journalSizeLimit < 0) {
+        resolved.journalSizeLimit = SqliteGlobalConfig::GetJournalFileSize();
+    }
+    if (resolved.autoCheckpoint < 0) {
+        resolved.autoCheckpoint = SqliteGlobalConfig::GetWalAutoCheckpoint();
+    }
+    return resolved;
 }
 
 SqliteConfig::~SqliteConfig()
@@ -102,5 +167,50 @@ std::string SqliteConfig::GetDatabaseFileType() const
 {
     return databaseFileType;
 }
+
+int SqliteConfig::GetStatementCacheSize() const
+{
+    return statementCacheSize;
+}
+
+int SqliteConfig::GetMinReadConnectionCount() const
+{
+    return minReadConnectionCount;
+}
+
+int SqliteConfig::GetMaxReadConnectionCount() const
+{
+    return maxReadConnectionCount;
+}
+
+int SqliteConfig::GetReadConnectionIdleTimeout() const
+{
+    return readConnectionIdleTimeout;
+}
+
+int SqliteConfig::GetConnectionAcquireTimeout() const
+{
+    return connectionAcquireTimeout;
+}
+
+CheckpointPolicy SqliteConfig::GetCheckpointPolicy() const
+{
+    return checkpointPolicy;
+}
+
+int SqliteConfig::GetCheckpointWalPages() const
+{
+    return checkpointWalPages;
+}
+
+int SqliteConfig::GetCheckpointIdleTime() const
+{
+    return checkpointIdleTime;
+}
+
+const SqliteTuning &SqliteConfig::GetTuning(bool isWriteConnection) const
+{
+    return isWriteConnection ? writeTuning : readTuning;
+}
 } // namespace NativeRdb
 } // namespace OHOS
\ No newline at end of file
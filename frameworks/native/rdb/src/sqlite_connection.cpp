@@ -15,6 +15,7 @@
 
 #include "sqlite_connection.h"
 
+#include <algorithm>
 #include <memory>
 #include <securec.h>
 #include <sqlite3sym.h>
@@ -40,9 +41,11 @@ namespace NativeRdb {
 // error status
 const int ERROR_STATUS = -1;
 
-SqliteConnection *SqliteConnection::Open(const SqliteConfig &config, bool isWriteConnection, int &errCode)
+SqliteConnection *SqliteConnection::Open(const SqliteConfig &config, bool isWriteConnection, int &errCode,
+    StatementCacheStats *cacheStats)
 {
     auto connection = new SqliteConnection(isWriteConnection);
+    connection->cacheStats = cacheStats;
     errCode = connection->InnerOpen(config);
     if (errCode != E_OK) {
         delete connection;
@@ -55,8 +58,13 @@ SqliteConnection::SqliteConnection(bool isWriteConnection)
     : dbHandle(nullptr),
       isWriteConnection(isWriteConnection),
       isReadOnly(false),
-      statement(),
+      statement(nullptr),
       stepStatement(nullptr),
+      statementCacheSize(0),
+      cacheStats(nullptr),
+      schemaGeneration(0),
+      walPages(0),
+      checkpointedWalPages(0),
       filePath(""),
       openFlags(0)
 {
@@ -83,6 +91,7 @@ int SqliteConnection::InnerOpen(const SqliteConfig &config)
     }
 
     isReadOnly = !isWriteConnection || config.IsReadOnly();
+    statementCacheSize = static_cast<size_t>(config.GetStatementCacheSize());
     int openFileFlags = config.IsReadOnly() ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE);
     int errCode = sqlite3_open_v2(dbPath.c_str(), &dbHandle, openFileFlags, nullptr);
     if (errCode != SQLITE_OK) {
@@ -111,7 +120,8 @@ int SqliteConnection::Config(const SqliteConfig &config)
         return E_OK;
     }
 
-    int errCode = SetPageSize();
+    const SqliteTuning &tuning = config.GetTuning(isWriteConnection);
+    int errCode = SetPageSize(tuning.pageSize);
     if (errCode != E_OK) {
         return errCode;
     }
@@ -128,23 +138,34 @@ int SqliteConnection::Config(const SqliteConfig &config)
         return errCode;
     }
 
-    errCode = SetJournalSizeLimit();
+    errCode = SetJournalSizeLimit(tuning.journalSizeLimit);
     if (errCode != E_OK) {
         return errCode;
     }
 
-    errCode = SetAutoCheckpoint();
+    errCode = SetAutoCheckpoint(config.GetCheckpointPolicy(), tuning.autoCheckpoint);
     if (errCode != E_OK) {
         return errCode;
     }
 
-    return E_OK;
+    errCode = SetCacheSize(tuning.cacheSize);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+
+    // the pages of an encrypted database have to be decrypted, they can not be read from a mapping
+    errCode = SetMmapSize(config.IsEncrypted() ? 0 : tuning.mmapSize);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+
+    return SetTempStore(tuning.tempStore);
 }
 
 SqliteConnection::~SqliteConnection()
 {
     if (dbHandle != nullptr) {
-        statement.Finalize();
+        ClearStatementCache();
         if (stepStatement != nullptr) {
             stepStatement->Finalize();
         }
@@ -155,13 +176,18 @@ SqliteConnection::~SqliteConnection()
     }
 }
 
-int SqliteConnection::SetPageSize()
+bool SqliteConnection::IsInTransaction() const
+{
+    return sqlite3_get_autocommit(dbHandle) == 0;
+}
+
+int SqliteConnection::SetPageSize(int pageSize)
 {
     if (isReadOnly) {
         return E_OK;
     }
 
-    int targetValue = SqliteGlobalConfig::GetPageSize();
+    int targetValue = pageSize;
     int64_t value;
     int errCode = ExecuteGetLong(value, "PRAGMA page_size");
     if (errCode != E_OK) {
@@ -253,13 +279,13 @@ int SqliteConnection::SetJournalMode(const std::string &journalMode, const std::
     return errCode;
 }
 
-int SqliteConnection::SetJournalSizeLimit()
+int SqliteConnection::SetJournalSizeLimit(int journalSizeLimit)
 {
     if (isReadOnly) {
         return E_OK;
     }
 
-    int targetValue = SqliteGlobalConfig::GetJournalFileSize();
+    int targetValue = journalSizeLimit;
     int64_t currentValue;
     int errCode = ExecuteGetLong(currentValue, "PRAGMA journal_size_limit");
     if (errCode != E_OK) {
@@ -279,13 +305,23 @@ int SqliteConnection::SetJournalSizeLimit()
     return errCode;
 }
 
-int SqliteConnection::SetAutoCheckpoint()
+/**
+ * Lets the writes checkpoint the WAL file, or turns that off and tracks the WAL size instead
+ * when the checkpoints run in the background.
+ */
+int SqliteConnection::SetAutoCheckpoint(CheckpointPolicy policy, int autoCheckpoint)
 {
     if (isReadOnly) {
         return E_OK;
     }
 
-    int targetValue = SqliteGlobalConfig::GetWalAutoCheckpoint();
+    if (policy != CheckpointPolicy::AUTO) {
+        // replaces the hook of the auto checkpoint
+        sqlite3_wal_hook(dbHandle, &SqliteConnection::WalHook, this);
+        return E_OK;
+    }
+
+    int targetValue = autoCheckpoint;
     int64_t value;
     int errCode = ExecuteGetLong(value, "PRAGMA wal_autocheckpoint");
     if (errCode != E_OK) {
@@ -305,6 +341,92 @@ int SqliteConnection::SetAutoCheckpoint()
     return errCode;
 }
 
+/**
+ * Limits the page cache of the connection, in KiB.
+ */
+int SqliteConnection::SetCacheSize(int cacheSize)
+{
+    // a negative value of the pragma is a size in KiB instead of a number of pages
+    int errCode = ExecuteSql("PRAGMA cache_size=" + std::to_string(-static_cast<int64_t>(cacheSize)));
+    if (errCode != E_OK) {
+        LOG_ERROR("SqliteConnection SetCacheSize fail to set cache_size : %{public}d", errCode);
+    }
+    return errCode;
+}
+
+int SqliteConnection::SetMmapSize(int64_t mmapSize)
+{
+    int64_t result;
+    int errCode = ExecuteGetLong(result, "PRAGMA mmap_size=" + std::to_string(mmapSize));
+    if (errCode != E_OK) {
+        LOG_ERROR("SqliteConnection SetMmapSize fail to set mmap_size : %{public}d", errCode);
+    }
+    return errCode;
+}
+
+int SqliteConnection::SetTempStore(TempStore tempStore)
+{
+    if (tempStore == TempStore::DEFAULT) {
+        return E_OK;
+    }
+
+    std::string targetValue = (tempStore == TempStore::MEMORY) ? "MEMORY" : "FILE";
+    int errCode = ExecuteSql("PRAGMA temp_store=" + targetValue);
+    if (errCode != E_OK) {
+        LOG_ERROR("SqliteConnection SetTempStore fail to set temp_store : %{public}d", errCode);
+    }
+    return errCode;
+}
+
+int SqliteConnection::WalHook(void *data, sqlite3 *db, const char *dbName, int pages)
+{
+    auto connection = static_cast<SqliteConnection *>(data);
+    if (pages < connection->checkpointedWalPages) {
+        // the WAL file has been restarted from its beginning
+        connection->checkpointedWalPages = 0;
+    }
+    connection->walPages = pages - connection->checkpointedWalPages;
+    return SQLITE_OK;
+}
+
+int SqliteConnection::GetWalPages() const
+{
+    return walPages;
+}
+
+/**
+ * Checkpoints the WAL file into the database, the pages still in use by readers are left in the WAL file.
+ * A truncating checkpoint gives up at once instead of waiting for the readers in the busy handler, as it runs on
+ * the task scheduler thread shared by all stores.
+ * @return E_OK even if some pages could not be checkpointed, GetWalPages() tells how many are left
+ */
+int SqliteConnection::Checkpoint(CheckpointPolicy policy, int &checkpointedPages)
+{
+    int mode = (policy == CheckpointPolicy::TRUNCATE) ? SQLITE_CHECKPOINT_TRUNCATE : SQLITE_CHECKPOINT_PASSIVE;
+    int logPages = 0;
+    checkpointedPages = 0;
+    if (mode == SQLITE_CHECKPOINT_TRUNCATE) {
+        sqlite3_busy_timeout(dbHandle, 0);
+    }
+    int errCode = sqlite3_wal_checkpoint_v2(dbHandle, nullptr, mode, &logPages, &checkpointedPages);
+    if (mode == SQLITE_CHECKPOINT_TRUNCATE) {
+        sqlite3_busy_timeout(dbHandle, DEFAULT_BUSY_TIMEOUT_MS);
+    }
+    if (errCode != SQLITE_OK && errCode != SQLITE_BUSY) {
+        LOG_ERROR("SqliteConnection Checkpoint fail, err = %{public}d", errCode);
+        return SQLiteError::ErrNo(errCode);
+    }
+    // the WAL file is not in WAL mode when logPages is -1
+    logPages = std::max(logPages, 0);
+    checkpointedPages = std::max(checkpointedPages, 0);
+    // a truncated WAL file reports no pages at all
+    int pendingPages = walPages;
+    checkpointedWalPages = checkpointedPages;
+    walPages = logPages - checkpointedPages;
+    checkpointedPages = std::max(pendingPages - walPages, 0);
+    return E_OK;
+}
+
 int SqliteConnection::SetWalSyncMode(const std::string &syncMode)
 {
     std::string targetValue = SqliteGlobalConfig::GetWalSyncMode();
@@ -338,40 +460,40 @@ bool SqliteConnection::IsWriteConnection() const
 
 int SqliteConnection::Prepare(const std::string &sql, bool &outIsReadOnly)
 {
-    int errCode = statement.Prepare(dbHandle, sql);
+    int errCode = PrepareStatement(sql);
     if (errCode != E_OK) {
         return errCode;
     }
-    outIsReadOnly = statement.IsReadOnly();
+    outIsReadOnly = statement->IsReadOnly();
     return E_OK;
 }
 
 int SqliteConnection::PrepareAndGetInfo(const std::string &sql, bool &outIsReadOnly, int &numParameters,
     std::vector<std::string> &columnNames)
 {
-    int errCode = statement.Prepare(dbHandle, sql);
+    int errCode = PrepareStatement(sql);
     if (errCode != E_OK) {
         return errCode;
     }
 
-    errCode = statement.GetColumnCount(numParameters);
+    errCode = statement->GetColumnCount(numParameters);
     if (errCode != E_OK) {
         return errCode;
     }
 
     int columnCount;
-    errCode = statement.GetColumnCount(columnCount);
+    errCode = statement->GetColumnCount(columnCount);
     if (errCode != E_OK) {
         return errCode;
     }
     for (int i = 0; i < columnCount; i++) {
         std::string name;
-        statement.GetColumnName(i, name);
+        statement->GetColumnName(i, name);
         columnNames.push_back(name);
     }
-    outIsReadOnly = statement.IsReadOnly();
+    outIsReadOnly = statement->IsReadOnly();
 
-    errCode = statement.GetNumParameters(numParameters);
+    errCode = statement->GetNumParameters(numParameters);
     if (errCode != E_OK) {
         return errCode;
     }
@@ -385,19 +507,150 @@ int SqliteConnection::PrepareAndBind(const std::string &sql, const std::vector<V
         LOG_ERROR("SqliteConnection dbHandle is nullptr");
         return E_INVALID_STATEMENT;
     }
-    int errCode = statement.Prepare(dbHandle, sql);
+    int errCode = PrepareStatement(sql);
     if (errCode != E_OK) {
         return errCode;
     }
 
-    if (!isWriteConnection && !statement.IsReadOnly()) {
+    if (!isWriteConnection && !statement->IsReadOnly()) {
         return E_EXECUTE_WRITE_IN_READ_CONNECTION;
     }
 
-    errCode = statement.BindArguments(bindArgs);
+    // the callers reset the statement before bindArgs goes away, so the arguments are bound without copying
+    errCode = statement->BindArguments(bindArgs, true);
+    if (errCode != E_OK) {
+        statement->ResetStatementAndClearBindings();
+    }
     return errCode;
 }
 
+/**
+ * Obtains a prepared statement for the sql from the statement cache, preparing and caching it on a miss.
+ * The least recently used statement is finalized once the cache is full.
+ */
+int SqliteConnection::PrepareStatement(const std::string &sql)
+{
+    if (!pinnedStatements.empty()) {
+        auto pinned = pinnedStatements.find(sql);
+        if (pinned != pinnedStatements.end()) {
+            if (!pinned->second.owner.expired()) {
+                statement = pinned->second.statement;
+                if (cacheStats != nullptr) {
+                    cacheStats->hits++;
+                }
+                return E_OK;
+            }
+            pinnedStatements.erase(pinned);
+        }
+    }
+
+    auto it = statementCacheIndex.find(sql);
+    if (it != statementCacheIndex.end()) {
+        statementCache.splice(statementCache.begin(), statementCache, it->second);
+        statement = it->second->second;
+        if (cacheStats != nullptr) {
+            cacheStats->hits++;
+        }
+        return E_OK;
+    }
+
+    auto newStatement = std::make_shared<SqliteStatement>();
+    int errCode = newStatement->Prepare(dbHandle, sql);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    if (cacheStats != nullptr) {
+        cacheStats->misses++;
+    }
+
+    statement = newStatement;
+    if (statementCacheSize == 0) {
+        return E_OK;
+    }
+    while (statementCache.size() >= statementCacheSize) {
+        statementCacheIndex.erase(statementCache.back().first);
+        statementCache.pop_back();
+    }
+    statementCache.emplace_front(sql, newStatement);
+    statementCacheIndex[sql] = statementCache.begin();
+    return E_OK;
+}
+
+/**
+ * Obtains the statement pinned for the sql, taking it over from the statement cache or preparing it when the
+ * sql was not pinned on this connection yet.
+ */
+int SqliteConnection::PreparePinnedStatement(const std::shared_ptr<const PinnedSql> &pinnedSql)
+{
+    auto pinned = pinnedStatements.find(pinnedSql->sql);
+    if (pinned != pinnedStatements.end()) {
+        if (pinned->second.owner.expired()) {
+            pinned->second.owner = pinnedSql;
+        }
+        statement = pinned->second.statement;
+        if (cacheStats != nullptr) {
+            cacheStats->hits++;
+        }
+        return E_OK;
+    }
+
+    std::shared_ptr<SqliteStatement> newStatement;
+    auto it = statementCacheIndex.find(pinnedSql->sql);
+    if (it != statementCacheIndex.end()) {
+        newStatement = it->second->second;
+        statementCache.erase(it->second);
+        statementCacheIndex.erase(it);
+        if (cacheStats != nullptr) {
+            cacheStats->hits++;
+        }
+    } else {
+        newStatement = std::make_shared<SqliteStatement>();
+        int errCode = newStatement->Prepare(dbHandle, pinnedSql->sql);
+        if (errCode != E_OK) {
+            return errCode;
+        }
+        if (cacheStats != nullptr) {
+            cacheStats->misses++;
+        }
+    }
+
+    // the statements of the dropped owners go before another one is pinned
+    for (auto iter = pinnedStatements.begin(); iter != pinnedStatements.end();) {
+        iter = iter->second.owner.expired() ? pinnedStatements.erase(iter) : std::next(iter);
+    }
+    pinnedStatements.emplace(pinnedSql->sql, PinnedStatement { pinnedSql, newStatement });
+    statement = newStatement;
+    return E_OK;
+}
+
+void SqliteConnection::ClearStatementCache()
+{
+    statementCacheIndex.clear();
+    statementCache.clear();
+    pinnedStatements.clear();
+    statement = nullptr;
+}
+
+/**
+ * Drops the statements prepared before the schema of the given generation and reloads the schema, as sqlite
+ * only notices a schema change of another connection when it steps a statement.
+ */
+void SqliteConnection::RefreshSchema(uint64_t generation)
+{
+    if (schemaGeneration == generation) {
+        return;
+    }
+    ClearStatementCache();
+    stepStatement->Finalize();
+    int64_t count = 0;
+    int errCode = ExecuteGetLong(count, "SELECT COUNT(*) FROM sqlite_master");
+    if (errCode != E_OK) {
+        LOG_ERROR("SqliteConnection RefreshSchema : reload schema failed %{public}d", errCode);
+        return;
+    }
+    schemaGeneration = generation;
+}
+
 int SqliteConnection::ExecuteSql(const std::string &sql, const std::vector<ValueObject> &bindArgs)
 {
     int errCode = PrepareAndBind(sql, bindArgs);
@@ -405,18 +658,22 @@ int SqliteConnection::ExecuteSql(const std::string &sql, const std::vector<Value
         return errCode;
     }
 
-    errCode = statement.Step();
+    errCode = statement->Step();
     if (errCode == SQLITE_ROW) {
         LOG_ERROR("SqliteConnection Execute : Queries can be performed using query or QuerySql methods only");
-        statement.ResetStatementAndClearBindings();
+        statement->ResetStatementAndClearBindings();
         return E_QUERY_IN_EXECUTE;
     } else if (errCode != SQLITE_DONE) {
         LOG_ERROR("SqliteConnection Execute : err %{public}d", errCode);
-        statement.ResetStatementAndClearBindings();
+        statement->ResetStatementAndClearBindings();
         return SQLiteError::ErrNo(errCode);
     }
 
-    errCode = statement.ResetStatementAndClearBindings();
+    errCode = statement->ResetStatementAndClearBindings();
+    if (errCode == E_OK && SqliteUtils::GetSqlStatementType(sql) == SqliteUtils::STATEMENT_DDL) {
+        // the cached statements may describe the old schema, e.g. the columns of "SELECT *"
+        ClearStatementCache();
+    }
     return errCode;
 }
 
@@ -428,20 +685,20 @@ int SqliteConnection::ExecuteForChangedRowCount(
         return errCode;
     }
 
-    errCode = statement.Step();
+    errCode = statement->Step();
     if (errCode == SQLITE_ROW) {
         LOG_ERROR("SqliteConnection ExecuteForChangedRowCount : Queries can be performed using query or QuerySql "
                   "methods only");
-        statement.ResetStatementAndClearBindings();
+        statement->ResetStatementAndClearBindings();
         return E_QUERY_IN_EXECUTE;
     } else if (errCode != SQLITE_DONE) {
         LOG_ERROR("SqliteConnection ExecuteForChangedRowCount : failed %{public}d", errCode);
-        statement.ResetStatementAndClearBindings();
+        statement->ResetStatementAndClearBindings();
         return SQLiteError::ErrNo(errCode);
     }
 
     changedRows = sqlite3_changes(dbHandle);
-    errCode = statement.ResetStatementAndClearBindings();
+    errCode = statement->ResetStatementAndClearBindings();
     return errCode;
 }
 
@@ -453,20 +710,20 @@ int SqliteConnection::ExecuteForLastInsertedRowId(
         return errCode;
     }
 
-    errCode = statement.Step();
+    errCode = statement->Step();
     if (errCode == SQLITE_ROW) {
         LOG_ERROR("SqliteConnection ExecuteForLastInsertedRowId : Queries can be performed using query or QuerySql "
                   "methods only");
-        statement.ResetStatementAndClearBindings();
+        statement->ResetStatementAndClearBindings();
         return E_QUERY_IN_EXECUTE;
     } else if (errCode != SQLITE_DONE) {
         LOG_ERROR("SqliteConnection ExecuteForLastInsertedRowId : failed %{public}d", errCode);
-        statement.ResetStatementAndClearBindings();
+        statement->ResetStatementAndClearBindings();
         return SQLiteError::ErrNo(errCode);
     }
 
     outRowId = (sqlite3_changes(dbHandle) > 0) ? sqlite3_last_insert_rowid(dbHandle) : -1;
-    errCode = statement.ResetStatementAndClearBindings();
+    errCode = statement->ResetStatementAndClearBindings();
     return errCode;
 }
 
@@ -478,19 +735,75 @@ int SqliteConnection::ExecuteGetLong(
         return errCode;
     }
 
-    errCode = statement.Step();
+    errCode = statement->Step();
     if (errCode != SQLITE_ROW) {
-        statement.ResetStatementAndClearBindings();
+        statement->ResetStatementAndClearBindings();
         return E_NO_ROW_IN_QUERY;
     }
 
-    errCode = statement.GetColumnLong(0, outValue);
+    errCode = statement->GetColumnLong(0, outValue);
     if (errCode != E_OK) {
-        statement.ResetStatementAndClearBindings();
+        statement->ResetStatementAndClearBindings();
         return errCode;
     }
 
-    errCode = statement.ResetStatementAndClearBindings();
+    errCode = statement->ResetStatementAndClearBindings();
+    return errCode;
+}
+
+/**
+ * Executes the pinned sql without looking it up in the statement cache. outValue receives the row id, the
+ * changed row count or the long value of the first column depending on the result type.
+ */
+int SqliteConnection::ExecutePinned(const std::shared_ptr<const PinnedSql> &pinnedSql,
+    const std::vector<ValueObject> &bindArgs, PinnedSql::ResultType resultType, int64_t &outValue)
+{
+    if (dbHandle == nullptr) {
+        LOG_ERROR("SqliteConnection dbHandle is nullptr");
+        return E_INVALID_STATEMENT;
+    }
+    if (!isWriteConnection && !pinnedSql->isReadOnly) {
+        return E_EXECUTE_WRITE_IN_READ_CONNECTION;
+    }
+    int errCode = PreparePinnedStatement(pinnedSql);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    errCode = statement->BindArguments(bindArgs, true);
+    if (errCode != E_OK) {
+        statement->ResetStatementAndClearBindings();
+        return errCode;
+    }
+
+    errCode = statement->Step();
+    if (resultType == PinnedSql::LONG_VALUE) {
+        if (errCode != SQLITE_ROW) {
+            statement->ResetStatementAndClearBindings();
+            return E_NO_ROW_IN_QUERY;
+        }
+        errCode = statement->GetColumnLong(0, outValue);
+        if (errCode != E_OK) {
+            statement->ResetStatementAndClearBindings();
+            return errCode;
+        }
+    } else if (errCode == SQLITE_ROW) {
+        LOG_ERROR("SqliteConnection ExecutePinned : Queries can be performed using query or QuerySql methods only");
+        statement->ResetStatementAndClearBindings();
+        return E_QUERY_IN_EXECUTE;
+    } else if (errCode != SQLITE_DONE) {
+        LOG_ERROR("SqliteConnection ExecutePinned : failed %{public}d", errCode);
+        statement->ResetStatementAndClearBindings();
+        return SQLiteError::ErrNo(errCode);
+    } else if (resultType == PinnedSql::LAST_INSERTED_ROW_ID) {
+        outValue = (sqlite3_changes(dbHandle) > 0) ? sqlite3_last_insert_rowid(dbHandle) : -1;
+    } else if (resultType == PinnedSql::CHANGED_ROW_COUNT) {
+        outValue = sqlite3_changes(dbHandle);
+    }
+
+    errCode = statement->ResetStatementAndClearBindings();
+    if (errCode == E_OK && pinnedSql->type == SqliteUtils::STATEMENT_DDL) {
+        ClearStatementCache();
+    }
     return errCode;
 }
 
@@ -502,36 +815,81 @@ int SqliteConnection::ExecuteGetString(
         return errCode;
     }
 
-    errCode = statement.Step();
+    errCode = statement->Step();
     if (errCode != SQLITE_ROW) {
-        statement.ResetStatementAndClearBindings();
+        statement->ResetStatementAndClearBindings();
         return E_NO_ROW_IN_QUERY;
     }
 
-    errCode = statement.GetColumnString(0, outValue);
+    errCode = statement->GetColumnString(0, outValue);
     if (errCode != E_OK) {
-        statement.ResetStatementAndClearBindings();
+        statement->ResetStatementAndClearBindings();
         return errCode;
     }
 
-    errCode = statement.ResetStatementAndClearBindings();
+    errCode = statement->ResetStatementAndClearBindings();
     return errCode;
 }
 
+/**
+ * Prepares the sql once and executes it for every set of bind arguments. The changes of each execution are
+ * appended to rowChanges when it is given.
+ */
+int SqliteConnection::ExecuteBatch(int64_t &outChangedRows, const std::string &sql,
+    const std::vector<std::vector<ValueObject>> &bindArgsList, std::vector<int64_t> *rowChanges)
+{
+    outChangedRows = 0;
+    if (bindArgsList.empty()) {
+        return E_OK;
+    }
+
+    int errCode = PrepareAndBind(sql, bindArgsList.front());
+    if (errCode != E_OK) {
+        return errCode;
+    }
+
+    for (size_t i = 0; i < bindArgsList.size(); i++) {
+        if (i != 0) {
+            errCode = statement->BindArguments(bindArgsList[i], true);
+            if (errCode != E_OK) {
+                statement->ResetStatementAndClearBindings();
+                return errCode;
+            }
+        }
+
+        errCode = statement->Step();
+        if (errCode == SQLITE_ROW) {
+            LOG_ERROR("SqliteConnection ExecuteBatch : Queries can be performed using query or QuerySql methods only");
+            statement->ResetStatementAndClearBindings();
+            return E_QUERY_IN_EXECUTE;
+        } else if (errCode != SQLITE_DONE) {
+            LOG_ERROR("SqliteConnection ExecuteBatch : failed %{public}d", errCode);
+            statement->ResetStatementAndClearBindings();
+            return SQLiteError::ErrNo(errCode);
+        }
+
+        int changes = sqlite3_changes(dbHandle);
+        outChangedRows += changes;
+        if (rowChanges != nullptr) {
+            rowChanges->push_back(changes);
+        }
+        errCode = statement->ResetStatementAndClearBindings();
+        if (errCode != E_OK) {
+            return errCode;
+        }
+    }
+    return E_OK;
+}
+
 std::shared_ptr<SqliteStatement> SqliteConnection::BeginStepQuery(
-    int &errCode, const std::string &sql, const std::vector<std::string> &selectionArgs) const
+    int &errCode, const std::string &sql, const std::vector<ValueObject> &selectionArgs) const
 {
     errCode = stepStatement->Prepare(dbHandle, sql);
     if (errCode != E_OK) {
         return nullptr;
     }
 
-    std::vector<ValueObject> bindArgs;
-    for (auto item : selectionArgs) {
-        bindArgs.push_back(ValueObject(item));
-    }
-
-    errCode = stepStatement->BindArguments(bindArgs);
+    errCode = stepStatement->BindArguments(selectionArgs);
     if (errCode != E_OK) {
         return nullptr;
     }
@@ -552,10 +910,7 @@ int SqliteConnection::ChangeEncryptKey(const std::vector<uint8_t> &newKey)
         return SQLiteError::ErrNo(errCode);
     }
 
-    errCode = statement.Finalize();
-    if (errCode != SQLITE_OK) {
-        return errCode;
-    }
+    ClearStatementCache();
 
     errCode = stepStatement->Finalize();
     if (errCode != SQLITE_OK) {
@@ -658,13 +1013,15 @@ int SqliteConnection::ExecuteForSharedBlock(int &rowNum, std::string sql, const
 
     if (ClearSharedBlock(sharedBlock) == ERROR_STATUS) {
         LOG_ERROR("ExecuteForSharedBlock:sharedBlock is null.");
+        statement->ResetStatementAndClearBindings();
         return E_ERROR;
     }
 
-    sqlite3_stmt *tempSqlite3St = statement.GetSql3Stmt();
+    sqlite3_stmt *tempSqlite3St = statement->GetSql3Stmt();
     int columnNum = sqlite3_column_count(tempSqlite3St);
     if (SharedBlockSetColumnNum(sharedBlock, columnNum) == ERROR_STATUS) {
         LOG_ERROR("ExecuteForSharedBlock:sharedBlock is null.");
+        statement->ResetStatementAndClearBindings();
         return E_ERROR;
     }
 
@@ -680,12 +1037,15 @@ int SqliteConnection::ExecuteForSharedBlock(int &rowNum, std::string sql, const
     } else {
         FillSharedBlock(&sharedBlockInfo);
     }
+    // a full block moves the window on, so the readers need to know where it starts
+    sharedBlock->SetStartPos(static_cast<uint32_t>(sharedBlockInfo.startPos));
 
     if (!ResetStatement(&sharedBlockInfo)) {
+        statement->ResetStatementAndClearBindings();
         return E_ERROR;
     }
     rowNum = static_cast<int>(GetCombinedData(sharedBlockInfo.startPos, sharedBlockInfo.totalRows));
-    errCode = statement.ResetStatementAndClearBindings();
+    errCode = statement->ResetStatementAndClearBindings();
     return errCode;
 }
 } // namespace NativeRdb
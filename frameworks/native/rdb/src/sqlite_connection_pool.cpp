@@ -22,6 +22,7 @@
 #include "sqlite_global_config.h"
 #include "sqlite_utils.h"
 
+#include <algorithm>
 #include <condition_variable>
 #include <mutex>
 #include <vector>
@@ -44,51 +45,87 @@ SqliteConnectionPool *SqliteConnectionPool::Create(const RdbStoreConfig &storeCo
 }
 
 SqliteConnectionPool::SqliteConnectionPool(const RdbStoreConfig &storeConfig)
-    : config(storeConfig), writeConnection(nullptr), writeConnectionUsed(true), readConnections(),
-      readConnectionCount(0), idleReadConnectionCount(0), transactionStack()
+    : config(storeConfig), writeConnection(nullptr), writeConnectionUsed(true),
+      acquireTimeout(config.GetConnectionAcquireTimeout()), checkpointPolicy(config.GetCheckpointPolicy()),
+      checkpointWalPages(config.GetCheckpointWalPages()), checkpointIdleTime(config.GetCheckpointIdleTime()),
+      checkpointTaskId(TaskScheduler::INVALID_TASK_ID), checkpointSequence(0), isCheckpointDue(false),
+      readConnections(),
+      readConnectionCount(0), idleReadConnectionCount(0), minReadConnectionCount(0), maxReadConnectionCount(0),
+      prefetchConnectionCount(0),
+      schemaGeneration(0), readConnectionIdleTimeout(0), idleCheckTaskId(TaskScheduler::INVALID_TASK_ID),
+      isClosing(false), transactionStack()
 {
 }
 
 int SqliteConnectionPool::Init()
 {
     int errCode = E_OK;
-    writeConnection = SqliteConnection::Open(config, true, errCode);
+    writeConnection = SqliteConnection::Open(config, true, errCode, &statementCacheStats);
     if (writeConnection == nullptr) {
         return errCode;
     }
 
     InitReadConnectionCount();
 
-    for (int i = 0; i < readConnectionCount; i++) {
-        SqliteConnection *connection = SqliteConnection::Open(config, false, errCode);
+    for (int i = 0; i < minReadConnectionCount; i++) {
+        SqliteConnection *connection = OpenReadConnection(errCode);
         if (connection == nullptr) {
             CloseAllConnections();
             config.ClearEncryptKey();
             return errCode;
         }
-        readConnections.push_back(connection);
+        readConnections.emplace_back(connection, Clock::now());
     }
 
     writeConnectionUsed = false;
-    idleReadConnectionCount = readConnectionCount;
+    readConnectionCount = minReadConnectionCount;
+    idleReadConnectionCount = minReadConnectionCount;
     return E_OK;
 }
 
 SqliteConnectionPool::~SqliteConnectionPool()
 {
+    TaskScheduler::TaskId taskId;
+    TaskScheduler::TaskId checkpointId;
+    {
+        std::scoped_lock<std::mutex, std::mutex> lock(readMutex, writeMutex);
+        isClosing = true;
+        taskId = idleCheckTaskId;
+        checkpointId = checkpointTaskId;
+    }
+    TaskScheduler::GetInstance().Remove(taskId);
+    TaskScheduler::GetInstance().Remove(checkpointId);
     config.ClearEncryptKey();
     CloseAllConnections();
 }
 
+/**
+ * Only WAL databases on disk can read concurrently with the write connection.
+ */
 void SqliteConnectionPool::InitReadConnectionCount()
 {
-    if (config.GetStorageMode() == StorageMode::MODE_MEMORY) {
-        readConnectionCount = 0;
-    } else if (config.GetJournalMode() == "WAL") {
-        readConnectionCount = SqliteGlobalConfig::GetReadConnectionCount();
+    if (config.GetStorageMode() == StorageMode::MODE_MEMORY || config.GetJournalMode() != "WAL") {
+        minReadConnectionCount = 0;
+        maxReadConnectionCount = 0;
     } else {
-        readConnectionCount = 0;
+        maxReadConnectionCount = config.GetMaxReadConnectionCount();
+        minReadConnectionCount = std::min(config.GetMinReadConnectionCount(), maxReadConnectionCount);
+    }
+    readConnectionIdleTimeout = std::chrono::milliseconds(config.GetReadConnectionIdleTimeout());
+}
+
+SqliteConnection *SqliteConnectionPool::OpenReadConnection(int &errCode)
+{
+    SqliteConnection *connection = SqliteConnection::Open(config, false, errCode, &statementCacheStats);
+    if (connection != nullptr) {
+        connection->RefreshSchema(schemaGeneration.load());
     }
+#ifdef RDB_SUPPORT_ICU
+    if (connection != nullptr && !locale.empty()) {
+        connection->ConfigLocale(locale);
+    }
+#endif
+    return connection;
 }
 
 void SqliteConnectionPool::CloseAllConnections()
@@ -100,23 +137,33 @@ void SqliteConnectionPool::CloseAllConnections()
     writeConnectionUsed = true;
 
     for (auto &item : readConnections) {
-        if (item != nullptr) {
-            delete item;
-            item = nullptr;
+        if (item.first != nullptr) {
+            delete item.first;
+            item.first = nullptr;
         }
     }
     readConnections.clear();
+    readConnectionCount = 0;
     idleReadConnectionCount = 0;
 }
 
-SqliteConnection *SqliteConnectionPool::AcquireConnection(bool isReadOnly)
+/**
+ * Acquires a connection, waiting at most the configured acquire timeout.
+ * @return nullptr with E_DATABASE_BUSY in errCode if no connection became free in time
+ */
+SqliteConnection *SqliteConnectionPool::AcquireConnection(bool isReadOnly, int &errCode)
 {
-    if (isReadOnly && readConnectionCount != 0) {
+    if (isReadOnly && maxReadConnectionCount != 0) {
         LOG_DEBUG("AcquireReadConnection");
-        return AcquireReadConnection();
+        SqliteConnection *connection = AcquireReadConnection(errCode);
+        if (connection != nullptr || errCode == E_DATABASE_BUSY) {
+            return connection;
+        }
+        LOG_ERROR("no read connection available, use the write connection");
+        return AcquireWriteConnection(errCode);
     } else {
         LOG_DEBUG("AcquireWriteConnection");
-        return AcquireWriteConnection();
+        return AcquireWriteConnection(errCode);
     }
 }
 void SqliteConnectionPool::ReleaseConnection(SqliteConnection *connection)
@@ -128,37 +175,218 @@ void SqliteConnectionPool::ReleaseConnection(SqliteConnection *connection)
     }
 }
 
-SqliteConnection *SqliteConnectionPool::AcquireWriteConnection()
+/**
+ * Waits in arrival order until isAvailable holds for the calling thread, or until the acquire timeout passes.
+ * The caller must hold the lock of the queue.
+ */
+bool SqliteConnectionPool::WaitInQueue(WaitQueue &queue, std::condition_variable &condition,
+    std::unique_lock<std::mutex> &lock, const std::function<bool()> &isAvailable)
+{
+    ConnectionPoolStats &stats = queue.stats;
+    if (queue.tickets.empty() && isAvailable()) {
+        stats.waitTimeHistogram[0]++;
+        stats.acquireCount++;
+        return true;
+    }
+
+    auto begin = Clock::now();
+    uint64_t ticket = queue.nextTicket++;
+    queue.tickets.push_back(ticket);
+    stats.maxQueueDepth = std::max(stats.maxQueueDepth, static_cast<int>(queue.tickets.size()));
+    auto isTurn = [&queue, ticket, &isAvailable] { return queue.tickets.front() == ticket && isAvailable(); };
+    bool acquired = true;
+    if (acquireTimeout.count() == 0) {
+        condition.wait(lock, isTurn);
+    } else {
+        acquired = condition.wait_until(lock, begin + acquireTimeout, isTurn);
+    }
+    queue.tickets.erase(std::find(queue.tickets.begin(), queue.tickets.end(), ticket));
+    // the next waiter may be able to go on as well, e.g. when several read connections are idle
+    condition.notify_all();
+
+    if (!acquired) {
+        stats.busyCount++;
+        return false;
+    }
+    auto waitTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin).count();
+    int bucket = 0;
+    while (bucket < ConnectionPoolStats::WAIT_TIME_BUCKET_COUNT - 1
+        && waitTime >= ConnectionPoolStats::WAIT_TIME_BOUNDS[bucket]) {
+        bucket++;
+    }
+    stats.waitTimeHistogram[bucket]++;
+    stats.acquireCount++;
+    return true;
+}
+
+void SqliteConnectionPool::RecordHoldTime(ConnectionPoolStats &stats, Clock::time_point acquireTime)
+{
+    auto holdTime = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - acquireTime).count();
+    stats.releaseCount++;
+    stats.totalHoldTime += holdTime;
+    stats.maxHoldTime = std::max(stats.maxHoldTime, static_cast<int64_t>(holdTime));
+}
+
+SqliteConnection *SqliteConnectionPool::AcquireWriteConnection(int &errCode)
 {
     LOG_DEBUG("begin");
     std::unique_lock<std::mutex> lock(writeMutex);
-    writeCondition.wait(lock, [&] { return !writeConnectionUsed; });
+    if (!WaitInQueue(writeQueue, writeCondition, lock, [this] { return !writeConnectionUsed; })) {
+        LOG_ERROR("wait for the write connection timeout");
+        errCode = E_DATABASE_BUSY;
+        return nullptr;
+    }
     writeConnectionUsed = true;
+    writeAcquireTime = Clock::now();
     LOG_DEBUG("end");
     return writeConnection;
 }
 
 void SqliteConnectionPool::ReleaseWriteConnection()
 {
+    TaskScheduler::TaskId replacedTaskId = TaskScheduler::INVALID_TASK_ID;
     {
         std::unique_lock<std::mutex> lock(writeMutex);
         writeConnectionUsed = false;
+        RecordHoldTime(writeQueue.stats, writeAcquireTime);
+        if (checkpointPolicy != CheckpointPolicy::AUTO) {
+            lastWriteTime = Clock::now();
+            replacedTaskId = ScheduleCheckpoint();
+        }
+    }
+    writeCondition.notify_all();
+    // removed without the lock as the task may be running and waiting for it
+    TaskScheduler::GetInstance().Remove(replacedTaskId);
+}
+
+/**
+ * Schedules a background checkpoint once the store has been idle long enough, or right away when the WAL file
+ * reached its size threshold. The caller must hold the write mutex.
+ * @return the task replaced by a checkpoint running right away, to be removed without the lock
+ */
+TaskScheduler::TaskId SqliteConnectionPool::ScheduleCheckpoint()
+{
+    if (isClosing || writeConnection == nullptr) {
+        return TaskScheduler::INVALID_TASK_ID;
+    }
+    int walPages = writeConnection->GetWalPages();
+    if (walPages == 0) {
+        return TaskScheduler::INVALID_TASK_ID;
+    }
+
+    bool isDue = walPages >= checkpointWalPages;
+    if (checkpointTaskId != TaskScheduler::INVALID_TASK_ID && (isCheckpointDue || !isDue)) {
+        return TaskScheduler::INVALID_TASK_ID;
+    }
+    TaskScheduler::TaskId replacedTaskId = checkpointTaskId;
+    isCheckpointDue = isDue;
+    ScheduleCheckpointTask(isDue ? std::chrono::milliseconds(0) : checkpointIdleTime);
+    return replacedTaskId;
+}
+
+void SqliteConnectionPool::ScheduleCheckpointTask(std::chrono::milliseconds delay)
+{
+    uint64_t sequence = ++checkpointSequence;
+    checkpointTaskId = TaskScheduler::GetInstance().Schedule(delay, [this, sequence] { RunCheckpoint(sequence); });
+}
+
+/**
+ * Checkpoints the WAL file with the write connection unless a thread is using or waiting for it,
+ * that thread schedules the checkpoint again when it releases the connection.
+ */
+void SqliteConnectionPool::RunCheckpoint(uint64_t sequence)
+{
+    std::unique_lock<std::mutex> lock(writeMutex);
+    if (isClosing || sequence != checkpointSequence) {
+        return;
+    }
+    checkpointTaskId = TaskScheduler::INVALID_TASK_ID;
+    // the connections failed to reopen after a restore
+    if (writeConnection == nullptr) {
+        return;
+    }
+    int walPages = writeConnection->GetWalPages();
+    auto idleTime = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - lastWriteTime);
+    if (walPages == 0 || writeConnectionUsed || !writeQueue.tickets.empty()) {
+        return;
     }
-    writeCondition.notify_one();
+    if (walPages < checkpointWalPages && idleTime < checkpointIdleTime) {
+        isCheckpointDue = false;
+        ScheduleCheckpointTask(checkpointIdleTime - idleTime);
+        return;
+    }
+
+    writeConnectionUsed = true;
+    SqliteConnection *connection = writeConnection;
+    lock.unlock();
+    auto begin = Clock::now();
+    int checkpointedPages = 0;
+    int errCode = connection->Checkpoint(checkpointPolicy, checkpointedPages);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin).count();
+    lock.lock();
+    writeConnectionUsed = false;
+    if (errCode == E_OK) {
+        checkpointStats.checkpointCount++;
+        checkpointStats.checkpointedPages += static_cast<uint64_t>(checkpointedPages);
+        checkpointStats.totalTime += elapsed;
+        checkpointStats.maxTime = std::max(checkpointStats.maxTime, static_cast<int64_t>(elapsed));
+    }
+    if (errCode != E_OK || connection->GetWalPages() > 0) {
+        // retry once the readers holding the remaining pages may have moved on
+        checkpointStats.incompleteCount++;
+        isCheckpointDue = false;
+        ScheduleCheckpointTask(checkpointIdleTime);
+    }
+    lock.unlock();
+    writeCondition.notify_all();
+}
+
+void SqliteConnectionPool::GetCheckpointStats(CheckpointStats &stats)
+{
+    std::unique_lock<std::mutex> lock(writeMutex);
+    stats = checkpointStats;
+    stats.walPages = (writeConnection != nullptr) ? writeConnection->GetWalPages() : 0;
 }
 
 /**
- * get last element from connectionPool
- * @return
+ * get the most recently used idle read connection, or open a new one while below the maximum count
+ * @return nullptr if no read connection became free in time or a new one can not be opened
  */
-SqliteConnection *SqliteConnectionPool::AcquireReadConnection()
+SqliteConnection *SqliteConnectionPool::AcquireReadConnection(int &errCode)
 {
     LOG_DEBUG("idleReadConnectionCount:%{public}d", idleReadConnectionCount);
     std::unique_lock<std::mutex> lock(readMutex);
-    readCondition.wait(lock, [&] { return idleReadConnectionCount > 0; });
-    SqliteConnection *connection = readConnections.back();
-    readConnections.pop_back();
-    idleReadConnectionCount--;
+    auto isAvailable = [this] {
+        return idleReadConnectionCount > 0 || readConnectionCount < maxReadConnectionCount;
+    };
+    if (!WaitInQueue(readQueue, readCondition, lock, isAvailable)) {
+        LOG_ERROR("wait for a read connection timeout");
+        errCode = E_DATABASE_BUSY;
+        return nullptr;
+    }
+
+    SqliteConnection *connection = nullptr;
+    if (idleReadConnectionCount > 0) {
+        connection = readConnections.back().first;
+        readConnections.pop_back();
+        idleReadConnectionCount--;
+    } else {
+        // reserve the slot so that the connection can be opened without holding the lock
+        readConnectionCount++;
+        lock.unlock();
+        connection = OpenReadConnection(errCode);
+        lock.lock();
+        if (connection == nullptr) {
+            LOG_ERROR("open read connection failed, errCode=%{public}d", errCode);
+            readConnectionCount--;
+            readCondition.notify_all();
+            return nullptr;
+        }
+    }
+    busyReadConnections[connection] = Clock::now();
+    lock.unlock();
+    // the connection is held by this thread alone now, so the refresh and its query do not block other readers
+    connection->RefreshSchema(schemaGeneration.load());
     return connection;
 }
 
@@ -171,10 +399,51 @@ void SqliteConnectionPool::ReleaseReadConnection(SqliteConnection *connection)
     LOG_DEBUG("idleReadConnectionCount:%{public}d", idleReadConnectionCount);
     {
         std::unique_lock<std::mutex> lock(readMutex);
-        readConnections.push_back(connection);
+        auto iter = busyReadConnections.find(connection);
+        if (iter != busyReadConnections.end()) {
+            RecordHoldTime(readQueue.stats, iter->second);
+            busyReadConnections.erase(iter);
+        }
+        readConnections.emplace_back(connection, Clock::now());
         idleReadConnectionCount++;
+        ScheduleIdleReadCheck();
+    }
+    readCondition.notify_all();
+}
+
+/**
+ * Schedules closing the read connections above the minimum count once they have been idle long enough.
+ * The caller must hold readMutex.
+ */
+void SqliteConnectionPool::ScheduleIdleReadCheck()
+{
+    if (isClosing || idleCheckTaskId != TaskScheduler::INVALID_TASK_ID
+        || readConnectionCount <= minReadConnectionCount) {
+        return;
     }
-    readCondition.notify_one();
+
+    auto delay = readConnectionIdleTimeout;
+    if (!readConnections.empty()) {
+        auto idleTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+            Clock::now() - readConnections.front().second);
+        delay = std::max(readConnectionIdleTimeout - idleTime, std::chrono::milliseconds(0));
+    }
+    idleCheckTaskId = TaskScheduler::GetInstance().Schedule(delay, [this] { CloseIdleReadConnections(); });
+}
+
+void SqliteConnectionPool::CloseIdleReadConnections()
+{
+    std::unique_lock<std::mutex> lock(readMutex);
+    idleCheckTaskId = TaskScheduler::INVALID_TASK_ID;
+    auto now = Clock::now();
+    while (readConnectionCount > minReadConnectionCount && !readConnections.empty()
+        && now - readConnections.front().second >= readConnectionIdleTimeout) {
+        delete readConnections.front().first;
+        readConnections.pop_front();
+        readConnectionCount--;
+        idleReadConnectionCount--;
+    }
+    ScheduleIdleReadCheck();
 }
 
 bool SqliteConnectionPool::IsOverLength(const std::vector<uint8_t> &newKey)
@@ -224,35 +493,35 @@ int SqliteConnectionPool::ChangeEncryptKey(const std::vector<uint8_t> &newKey)
     return errCode;
 }
 
+/**
+ * Reopens the idle read connections, the caller must hold readMutex.
+ */
 int SqliteConnectionPool::InnerReOpenReadConnections()
 {
     int errCode = E_OK;
     for (auto &item : readConnections) {
-        if (item != nullptr) {
-            delete item;
-            item = nullptr;
+        if (item.first != nullptr) {
+            delete item.first;
+            item.first = nullptr;
         }
-    }
-    readConnections.clear();
-
-    for (int i = 0; i < readConnectionCount; i++) {
-        SqliteConnection *connection = SqliteConnection::Open(config, false, errCode);
-        if (connection == nullptr) {
+        item.first = OpenReadConnection(errCode);
+        if (item.first == nullptr) {
             config.ClearEncryptKey();
             CloseAllConnections();
             return errCode;
         }
-        readConnections.push_back(connection);
     }
 
     return errCode;
 }
 
-
-int SqliteConnectionPool::ReOpenAvailableReadConnections()
+/**
+ * Called after the schema was changed through the write connection. Instead of reopening them, the read
+ * connections refresh lazily when they are acquired next, including those in use right now.
+ */
+void SqliteConnectionPool::NotifySchemaChanged()
 {
-    std::unique_lock<std::mutex> lock(readMutex);
-    return InnerReOpenReadConnections();
+    schemaGeneration++;
 }
 
 #ifdef RDB_SUPPORT_ICU
@@ -262,18 +531,20 @@ int SqliteConnectionPool::ReOpenAvailableReadConnections()
 int SqliteConnectionPool::ConfigLocale(const std::string localeStr)
 {
     std::unique_lock<std::mutex> lock(rdbMutex);
+    std::unique_lock<std::mutex> readLock(readMutex);
     if (idleReadConnectionCount != readConnectionCount) {
         return E_NO_ROW_IN_QUERY;
     }
 
-    for (int i = 0; i < idleReadConnectionCount; i++) {
-        SqliteConnection *connection = readConnections[i];
+    for (auto &item : readConnections) {
+        SqliteConnection *connection = item.first;
         if (connection == nullptr) {
             LOG_ERROR("Read Connection is null.");
             return E_ERROR;
         }
         connection->ConfigLocale(localeStr);
     }
+    locale = localeStr;
 
     if (writeConnection == nullptr) {
         LOG_ERROR("Write Connection is null.");
@@ -287,15 +558,28 @@ int SqliteConnectionPool::ConfigLocale(const std::string localeStr)
 #endif
 
 /**
- * Rename the backed up database.
+ * Rename the backed up database. All connections are closed first, which also unmaps the old file from the read
+ * connections using memory mapping, the reopened ones map the new file unless it is encrypted.
  */
 int SqliteConnectionPool::ChangeDbFileForRestore(const std::string newPath, const std::string backupPath,
     const std::vector<uint8_t> &newKey)
 {
+    TaskScheduler::TaskId checkpointId;
+    {
+        std::scoped_lock<std::mutex, std::mutex> lock(readMutex, writeMutex);
+        checkpointId = checkpointTaskId;
+    }
+    // removed without the lock as the task may be running and waiting for it
+    TaskScheduler::GetInstance().Remove(checkpointId);
+
+    std::scoped_lock<std::mutex, std::mutex> lock(readMutex, writeMutex);
     if (writeConnectionUsed == true || idleReadConnectionCount != readConnectionCount) {
         LOG_ERROR("Connection pool is busy now!");
         return E_ERROR;
     }
+    // a checkpoint scheduled meanwhile finds its sequence outdated and leaves the closed connection alone
+    checkpointSequence++;
+    checkpointTaskId = TaskScheduler::INVALID_TASK_ID;
 
     CloseAllConnections();
 
@@ -325,6 +609,50 @@ int SqliteConnectionPool::ChangeDbFileForRestore(const std::string newPath, cons
     return Init();
 }
 
+void SqliteConnectionPool::GetStatementCacheStats(uint64_t &hits, uint64_t &misses) const
+{
+    hits = statementCacheStats.hits.load();
+    misses = statementCacheStats.misses.load();
+}
+
+void SqliteConnectionPool::GetConnectionPoolStats(ConnectionPoolStats &writeStats, ConnectionPoolStats &readStats)
+{
+    {
+        std::unique_lock<std::mutex> lock(writeMutex);
+        writeStats = writeQueue.stats;
+    }
+    std::unique_lock<std::mutex> lock(readMutex);
+    readStats = readQueue.stats;
+}
+
+void SqliteConnectionPool::GetReadConnectionCount(int &total, int &idle)
+{
+    std::unique_lock<std::mutex> lock(readMutex);
+    total = readConnectionCount;
+    idle = idleReadConnectionCount;
+}
+
+/**
+ * Reserves a read connection for a prefetch worker, which keeps it for a whole scan, even while it waits for the
+ * reader. Fails unless another read connection is left to the other reads, so they can not wait for the workers
+ * forever, and always when reads share the write connection.
+ */
+bool SqliteConnectionPool::ReservePrefetchConnection()
+{
+    std::unique_lock<std::mutex> lock(readMutex);
+    if (prefetchConnectionCount + 1 >= maxReadConnectionCount) {
+        return false;
+    }
+    prefetchConnectionCount++;
+    return true;
+}
+
+void SqliteConnectionPool::ReleasePrefetchConnection()
+{
+    std::unique_lock<std::mutex> lock(readMutex);
+    prefetchConnectionCount = std::max(prefetchConnectionCount - 1, 0);
+}
+
 std::stack<BaseTransaction> &SqliteConnectionPool::getTransactionStack()
 {
     return transactionStack;
@@ -26,12 +26,23 @@ namespace NativeRdb {
 const int SqliteGlobalConfig::SOFT_HEAP_LIMIT = 8 * 1024 * 1024; /* 8MB */
 const bool SqliteGlobalConfig::CALLBACK_LOG_SWITCH = true;       /* Sqlite callback log switch */
 const int SqliteGlobalConfig::CONNECTION_POOL_SIZE = 4;
+const int SqliteGlobalConfig::MIN_READ_CONNECTION_COUNT = 1;
+const int SqliteGlobalConfig::READ_CONNECTION_IDLE_TIMEOUT = 30000; /* 30s */
+const int SqliteGlobalConfig::CONNECTION_ACQUIRE_TIMEOUT = 0; /* 0 means waiting without a deadline */
 const std::string SqliteGlobalConfig::MEMORY_DB_PATH = ":memory:";
 const int SqliteGlobalConfig::DB_PAGE_SIZE = 4096;
 const std::string SqliteGlobalConfig::DEFAULT_JOURNAL_MODE = "WAL";
 const std::string SqliteGlobalConfig::WAL_SYNC_MODE = "FULL";
 const int SqliteGlobalConfig::JOURNAL_FILE_SIZE = 524288; /* 512KB */
 const int SqliteGlobalConfig::WAL_AUTO_CHECKPOINT = 100;  /* 100 pages */
+const int SqliteGlobalConfig::CHECKPOINT_WAL_PAGES = 1000; /* 1000 pages */
+const int SqliteGlobalConfig::CHECKPOINT_IDLE_TIME = 1000; /* 1s */
+const int SqliteGlobalConfig::WRITE_CACHE_SIZE = 2048;     /* 2MB, the writer keeps the hot pages of the writes */
+const int SqliteGlobalConfig::READ_CACHE_SIZE = 1024;      /* 1MB for each of the read connections */
+const int64_t SqliteGlobalConfig::MMAP_SIZE = 0;           /* no memory mapping */
+const int64_t SqliteGlobalConfig::READ_MMAP_SIZE_LIMIT = 256 * 1024 * 1024; /* 256MB */
+const int SqliteGlobalConfig::STATEMENT_CACHE_SIZE = 16;  /* 16 statements per connection */
+const int SqliteGlobalConfig::JSON_BUILTIN_VERSION = 3038000; /* 3.38.0, the JSON functions are built in */
 constexpr int APP_DEFAULT_UMASK = 0002;
 
 void SqliteGlobalConfig::InitSqliteGlobalConfig()
@@ -76,6 +87,21 @@ int SqliteGlobalConfig::GetReadConnectionCount()
     return CONNECTION_POOL_SIZE - 1;
 }
 
+int SqliteGlobalConfig::GetMinReadConnectionCount()
+{
+    return MIN_READ_CONNECTION_COUNT;
+}
+
+int SqliteGlobalConfig::GetReadConnectionIdleTimeout()
+{
+    return READ_CONNECTION_IDLE_TIMEOUT;
+}
+
+int SqliteGlobalConfig::GetConnectionAcquireTimeout()
+{
+    return CONNECTION_ACQUIRE_TIMEOUT;
+}
+
 std::string SqliteGlobalConfig::GetMemoryDbPath()
 {
     return MEMORY_DB_PATH;
@@ -101,9 +127,50 @@ int SqliteGlobalConfig::GetWalAutoCheckpoint()
     return WAL_AUTO_CHECKPOINT;
 }
 
+int SqliteGlobalConfig::GetCheckpointWalPages()
+{
+    return CHECKPOINT_WAL_PAGES;
+}
+
+int SqliteGlobalConfig::GetCheckpointIdleTime()
+{
+    return CHECKPOINT_IDLE_TIME;
+}
+
+int SqliteGlobalConfig::GetCacheSize(bool isWriteConnection)
+{
+    return isWriteConnection ? WRITE_CACHE_SIZE : READ_CACHE_SIZE;
+}
+
+int64_t SqliteGlobalConfig::GetMmapSize(bool isWriteConnection)
+{
+    return MMAP_SIZE;
+}
+
+int64_t SqliteGlobalConfig::GetReadMmapSizeLimit()
+{
+    return READ_MMAP_SIZE_LIMIT;
+}
+
 std::string SqliteGlobalConfig::GetDefaultJournalMode()
 {
     return DEFAULT_JOURNAL_MODE;
 }
+
+int SqliteGlobalConfig::GetStatementCacheSize()
+{
+    return STATEMENT_CACHE_SIZE;
+}
+
+/**
+ * Whether json_each() is available, built in since 3.38 unless omitted and an optional extension before.
+ */
+bool SqliteGlobalConfig::IsJsonSupported()
+{
+    static const bool isSupported =
+        (sqlite3_libversion_number() >= JSON_BUILTIN_VERSION && sqlite3_compileoption_used("OMIT_JSON") == 0)
+        || sqlite3_compileoption_used("ENABLE_JSON1") != 0;
+    return isSupported;
+}
 } // namespace NativeRdb
 } // namespace OHOS
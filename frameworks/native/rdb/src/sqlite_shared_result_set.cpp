@@ -19,19 +19,30 @@
 #include <memory>
 #include <rdb_errno.h>
 #include "logger.h"
+#include "share_block.h"
 
 namespace OHOS {
 namespace NativeRdb {
 SqliteSharedResultSet::SqliteSharedResultSet(std::shared_ptr<RdbStoreImpl> rdbSreImpl, std::string path,
-    std::string sql, const std::vector<std::string> &bindArgs)
-    : AbsSharedResultSet(path), resultSetBlockCapacity(0), isOnlyFillResultSetBlock(false), rdbStoreImpl(rdbSreImpl),
-      qrySql(sql), selectionArgVec(bindArgs), rowNum(NO_COUNT)
+    std::string sql, const std::vector<ValueObject> &bindArgs)
+    : AbsSharedResultSet(path, INITIAL_BLOCK_SIZE), resultSetBlockCapacity(0), isOnlyFillResultSetBlock(false),
+      rdbStoreImpl(rdbSreImpl), qrySql(sql), selectionArgVec(bindArgs), rowNum(NO_COUNT),
+      minBlockSize(MIN_BLOCK_SIZE), maxBlockSize(MAX_BLOCK_SIZE), isPrefetch(false), isPrefetchStopping(false),
+      prefetchState(PREFETCH_IDLE), prefetchStartPos(0), prefetchBlock(nullptr)
 {}
 
-SqliteSharedResultSet::~SqliteSharedResultSet() {}
+SqliteSharedResultSet::~SqliteSharedResultSet()
+{
+    StopPrefetch();
+}
 
 int SqliteSharedResultSet::GetAllColumnNames(std::vector<std::string> &columnNames)
 {
+    if (!queryColumnNames.empty()) {
+        columnNames = queryColumnNames;
+        return E_OK;
+    }
+
     int errCode = PrepareStep();
     if (errCode) {
         return errCode;
@@ -55,7 +66,7 @@ int SqliteSharedResultSet::GetAllColumnNames(std::vector<std::string> &columnNam
 
     rdbStoreImpl->EndStepQuery();
     sqliteStatement = nullptr;
-
+    queryColumnNames = columnNames;
     return E_OK;
 }
 
@@ -72,6 +83,7 @@ int SqliteSharedResultSet::Close()
 {
     std::lock_guard<std::mutex> lock(sessionMutex);
 
+    StopPrefetch();
     AbsSharedResultSet::Close();
 
     return E_OK;
@@ -91,7 +103,7 @@ bool SqliteSharedResultSet::OnGo(int oldPosition, int newPosition)
         FillSharedBlock(newPosition);
         return true;
     }
-    if (newPosition >= (int)GetBlock()->GetRowNum()) {
+    if (!IsRowInBlock(newPosition) && !TakePrefetchedBlock(newPosition)) {
         FillSharedBlock(newPosition);
     }
     return true;
@@ -107,33 +119,111 @@ int SqliteSharedResultSet::PickFillBlockStartPosition(int resultSetPosition, int
 
 void SqliteSharedResultSet::FillSharedBlock(int requiredPos)
 {
-    ClearBlock();
-
     if (!HasBlock()) {
         LOG_ERROR("SqliteSharedResultSet::FillSharedBlock sharedBlock is null.");
         return;
     }
 
-    std::vector<ValueObject> bindArgs;
-    size_t size = selectionArgVec.size();
+    StopPrefetch();
+    ResizeBlock(PickBlockSize(requiredPos));
+    int errCode = FillWindow(requiredPos);
+    // a row larger than the whole block fails the fill, so grow the block while that row is still to be read
+    while (errCode == E_ERROR && GetBlock()->GetRowNum() == 0 && (rowNum == NO_COUNT || requiredPos < rowNum) &&
+        GetBlock()->Size() < maxBlockSize && ResizeBlock(std::min(GetBlock()->Size() * 2, maxBlockSize))) {
+        errCode = FillWindow(requiredPos);
+    }
 
-    for (size_t i = 0; i < size; i++) {
-        ValueObject vauObj(selectionArgVec[i]);
-        bindArgs.push_back(vauObj);
+    size_t filledRows = GetBlock()->GetRowNum();
+    if (filledRows > 0) {
+        // the column-major arrays are reserved for the whole block, not taken row by row
+        size_t rowWidth = (GetBlock()->GetUsedBytes() - GetBlock()->GetColumnarBytes()) / filledRows;
+        blockStats.rowWidth = (blockStats.rowWidth == 0) ? rowWidth : (blockStats.rowWidth + rowWidth) / 2;
     }
+    RecordBlockFilled();
+    if (isPrefetch) {
+        StartPrefetch();
+    }
+}
 
+int SqliteSharedResultSet::FillWindow(int requiredPos)
+{
+    ClearBlock();
+
+    int errCode;
     if (rowNum == NO_COUNT) {
-        rdbStoreImpl->ExecuteForSharedBlock(rowNum, GetBlock(), requiredPos, requiredPos, true, qrySql, bindArgs);
+        errCode = rdbStoreImpl->ExecuteForSharedBlock(
+            rowNum, GetBlock(), requiredPos, requiredPos, true, qrySql, selectionArgVec);
         resultSetBlockCapacity = static_cast<int>(GetBlock()->GetRowNum());
     } else {
         int startPos =
             isOnlyFillResultSetBlock ? requiredPos : PickFillBlockStartPosition(requiredPos, resultSetBlockCapacity);
-        rdbStoreImpl->ExecuteForSharedBlock(rowNum, GetBlock(), startPos, requiredPos, false, qrySql, bindArgs);
+        errCode = rdbStoreImpl->ExecuteForSharedBlock(
+            rowNum, GetBlock(), startPos, requiredPos, false, qrySql, selectionArgVec);
+    }
+    return errCode;
+}
+
+/**
+ * Picks the block size for the window at requiredPos from the measured row width, big enough for the rest of
+ * the result from the start of the window when the limits allow it. The first window keeps the block it has.
+ */
+size_t SqliteSharedResultSet::PickBlockSize(int requiredPos) const
+{
+    if (rowNum == NO_COUNT || blockStats.rowWidth == 0 || requiredPos >= rowNum) {
+        return GetBlock()->Size();
+    }
+    int startPos =
+        isOnlyFillResultSetBlock ? requiredPos : PickFillBlockStartPosition(requiredPos, resultSetBlockCapacity);
+    size_t neededSize = blockStats.rowWidth * static_cast<size_t>(rowNum - startPos);
+    size_t blockSize = MIN_BLOCK_SIZE;
+    while (blockSize < neededSize && blockSize < maxBlockSize) {
+        blockSize <<= 1;
+    }
+    return std::min(std::max(blockSize, minBlockSize), maxBlockSize);
+}
+
+void SqliteSharedResultSet::RecordBlockFilled()
+{
+    size_t blockSize = GetBlock()->Size();
+    if (blockStats.fillCount == 0) {
+        blockStats.firstBlockSize = blockSize;
+    }
+    blockStats.fillCount++;
+    blockStats.lastBlockSize = blockSize;
+    blockStats.maxBlockSize = std::max(blockStats.maxBlockSize, blockSize);
+}
+
+/**
+ * Swaps the block for a pooled one of blockSize, keeping the current block when it is of that size already, was
+ * sent to a peer or had its fd handed out, or no other can be had.
+ */
+bool SqliteSharedResultSet::ResizeBlock(size_t blockSize)
+{
+    size_t currentSize = GetBlock()->Size();
+    if (currentSize >= blockSize && currentSize / 2 < blockSize) {
+        return true;
+    }
+    // a peer keeps reading the block it was sent, and the holders of its fd keep mapping it
+    if (GetBlock()->IsShared()) {
+        return false;
+    }
+    AppDataFwk::SharedBlock *block = nullptr;
+    if (AppDataFwk::SharedBlock::Lease(GetBlock()->Name(), blockSize, block) !=
+        AppDataFwk::SharedBlock::SHARED_BLOCK_OK) {
+        LOG_ERROR("SqliteSharedResultSet::ResizeBlock failed to lease a block of %{public}zu bytes.", blockSize);
+        return false;
     }
+    block->SetColumnarColumns(columnarColumns);
+    AbsSharedResultSet::SetBlock(block);
+    if (blockStats.rowWidth > 0) {
+        resultSetBlockCapacity = static_cast<int>(block->Size() / blockStats.rowWidth);
+    }
+    return true;
 }
 
 void SqliteSharedResultSet::SetBlock(AppDataFwk::SharedBlock *block)
 {
+    StopPrefetch();
     AbsSharedResultSet::SetBlock(block);
     rowNum = NO_COUNT;
 }
@@ -147,6 +237,237 @@ void SqliteSharedResultSet::SetFillBlockForwardOnly(bool isOnlyFillResultSetBloc
     isOnlyFillResultSetBlock = isOnlyFillResultSetBlockInput;
 }
 
+/**
+ * The columns are kept column-major from the next filled block on, so set them before reading any row.
+ */
+int SqliteSharedResultSet::SetColumnarColumns(const std::vector<int> &columnIndexes)
+{
+    if (!HasBlock()) {
+        LOG_ERROR("SqliteSharedResultSet::SetColumnarColumns sharedBlock is null.");
+        return E_ERROR;
+    }
+    // the filled window has no arrays, GetColumnView would fail on it as if the column was not columnar
+    if (rowNum != NO_COUNT) {
+        LOG_ERROR("SqliteSharedResultSet::SetColumnarColumns the first window is filled already.");
+        return E_NOT_SUPPORT;
+    }
+    std::vector<uint32_t> columns;
+    for (int columnIndex : columnIndexes) {
+        if (columnIndex < 0) {
+            return E_INVALID_COLUMN_INDEX;
+        }
+        columns.push_back(static_cast<uint32_t>(columnIndex));
+    }
+    GetBlock()->SetColumnarColumns(columns);
+    columnarColumns = columns;
+    return E_OK;
+}
+
+/**
+ * Bounds the size of the blocks picked for the windows after the first one, before the pool rounds them up to a
+ * power of two.
+ */
+int SqliteSharedResultSet::SetBlockSizeLimits(size_t minBlockSize, size_t maxBlockSize)
+{
+    if (minBlockSize == 0 || minBlockSize > maxBlockSize) {
+        LOG_ERROR("SqliteSharedResultSet::SetBlockSizeLimits invalid limits %{public}zu, %{public}zu.", minBlockSize,
+            maxBlockSize);
+        return E_ERROR;
+    }
+    this->minBlockSize = minBlockSize;
+    this->maxBlockSize = maxBlockSize;
+    return E_OK;
+}
+
+int SqliteSharedResultSet::GetBlockStats(BlockStats &stats) const
+{
+    stats = blockStats;
+    return E_OK;
+}
+
+/**
+ * Fills the next window on a worker thread while the current one is read. The worker keeps its statement
+ * positioned after the rows it filled, so no window steps the query from its first row again. Meant for cursors
+ * that only move forward, a move outside the prefetched window falls back to filling the block synchronously.
+ * The worker holds a read connection until the last row is filled or the result set is closed. The workers of a
+ * store may only hold all its read connections but one, the windows of the result sets over that limit are filled
+ * synchronously, and stores with less than two read connections do not support it. The windows read while this
+ * thread is in a transaction are filled synchronously too, a read connection does not see its uncommitted rows.
+ */
+int SqliteSharedResultSet::SetPrefetchNextBlock(bool isPrefetch)
+{
+    if (isPrefetch && HasBlock() && GetBlock()->IsShared()) {
+        LOG_ERROR("SqliteSharedResultSet::SetPrefetchNextBlock the block is read by a peer.");
+        return E_NOT_SUPPORT;
+    }
+    // tells early when no read connection is left to spare, StartPrefetch reserves one for each worker
+    if (isPrefetch && !prefetchThread.joinable()) {
+        if (!rdbStoreImpl->ReservePrefetchConnection()) {
+            LOG_ERROR("SqliteSharedResultSet::SetPrefetchNextBlock no read connection to spare.");
+            return E_NOT_SUPPORT;
+        }
+        rdbStoreImpl->ReleasePrefetchConnection();
+    }
+    this->isPrefetch = isPrefetch;
+    if (!isPrefetch) {
+        StopPrefetch();
+    } else if (rowNum != NO_COUNT && HasBlock()) {
+        StartPrefetch();
+    }
+    return E_OK;
+}
+
+void SqliteSharedResultSet::StartPrefetch()
+{
+    if (prefetchThread.joinable() || GetBlock()->IsShared() || rdbStoreImpl->IsInTransaction()) {
+        return;
+    }
+    int nextPos = static_cast<int>(GetBlock()->GetStartPos() + GetBlock()->GetRowNum());
+    if (GetBlock()->GetRowNum() == 0 || nextPos >= rowNum) {
+        return;
+    }
+    if (AppDataFwk::SharedBlock::Lease(GetBlock()->Name(), GetBlock()->Size(), prefetchBlock) !=
+        AppDataFwk::SharedBlock::SHARED_BLOCK_OK) {
+        LOG_ERROR("SqliteSharedResultSet::StartPrefetch failed to lease a block.");
+        prefetchBlock = nullptr;
+        return;
+    }
+    if (!rdbStoreImpl->ReservePrefetchConnection()) {
+        AppDataFwk::SharedBlock::Release(prefetchBlock);
+        prefetchBlock = nullptr;
+        return;
+    }
+    prefetchBlock->SetColumnarColumns(columnarColumns);
+    // the names take a read connection of their own, so cache them before the worker holds one
+    std::vector<std::string> columnNames;
+    GetAllColumnNames(columnNames);
+    isPrefetchStopping = false;
+    prefetchStartPos = nextPos;
+    prefetchState = PREFETCH_FILLING;
+    prefetchThread = std::thread(&SqliteSharedResultSet::PrefetchLoop, this, nextPos);
+}
+
+void SqliteSharedResultSet::StopPrefetch()
+{
+    if (!prefetchThread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(prefetchMutex);
+        isPrefetchStopping = true;
+    }
+    prefetchCondition.notify_all();
+    prefetchThread.join();
+    rdbStoreImpl->ReleasePrefetchConnection();
+    AppDataFwk::SharedBlock::Release(prefetchBlock);
+    prefetchBlock = nullptr;
+    prefetchState = PREFETCH_IDLE;
+}
+
+/**
+ * Runs on prefetchThread. Steps the statement to startPos once, then fills prefetchBlock whenever the reader
+ * hands it back in the PREFETCH_FILLING state.
+ */
+void SqliteSharedResultSet::PrefetchLoop(int startPos)
+{
+    int errCode = E_OK;
+    std::shared_ptr<SqliteStatement> statement = rdbStoreImpl->BeginStepQuery(errCode, qrySql, selectionArgVec);
+    bool isStepping = true;
+    bool isDone = (statement == nullptr);
+    for (int i = 0; !isDone && i < startPos; i++) {
+        isDone = (statement->Step() != SQLITE_ROW);
+    }
+
+    bool hasRow = false;
+    std::unique_lock<std::mutex> lock(prefetchMutex);
+    while (true) {
+        prefetchCondition.wait(lock, [this] { return isPrefetchStopping || prefetchState == PREFETCH_FILLING; });
+        if (isPrefetchStopping) {
+            break;
+        }
+        lock.unlock();
+        bool isFilled = !isDone && FillPrefetchBlock(*statement, hasRow);
+        isDone = !isFilled || !hasRow;
+        if (isDone && isStepping) {
+            // the connection is not needed past the last row
+            rdbStoreImpl->EndStepQuery();
+            isStepping = false;
+        }
+        lock.lock();
+        prefetchState = isFilled ? PREFETCH_READY : PREFETCH_FAILED;
+        prefetchCondition.notify_all();
+    }
+    lock.unlock();
+    if (isStepping) {
+        rdbStoreImpl->EndStepQuery();
+    }
+}
+
+/**
+ * Fills prefetchBlock with the rows after the current row of the statement, or from it when hasRow is set.
+ * hasRow is left set when the block is full before the last row.
+ */
+bool SqliteSharedResultSet::FillPrefetchBlock(SqliteStatement &statement, bool &hasRow)
+{
+    sqlite3_stmt *stmt = statement.GetSql3Stmt();
+    int columnNum = sqlite3_column_count(stmt);
+    if (prefetchBlock->Clear() != AppDataFwk::SharedBlock::SHARED_BLOCK_OK ||
+        prefetchBlock->SetColumnNum(static_cast<uint32_t>(columnNum)) != AppDataFwk::SharedBlock::SHARED_BLOCK_OK) {
+        LOG_ERROR("SqliteSharedResultSet::FillPrefetchBlock failed to reset the block.");
+        return false;
+    }
+    prefetchBlock->SetStartPos(static_cast<uint32_t>(prefetchStartPos));
+
+    SharedBlockInfo info(nullptr, prefetchBlock, stmt);
+    info.columnNum = columnNum;
+    info.startPos = prefetchStartPos;
+    FillSharedBlockStep(&info, hasRow);
+    if (info.hasException || (info.isFull && info.addedRows == 0)) {
+        LOG_ERROR("SqliteSharedResultSet::FillPrefetchBlock failed at row %{public}d.", prefetchStartPos);
+        return false;
+    }
+    hasRow = info.isFull;
+    return true;
+}
+
+/**
+ * Swaps in the prefetched window when it holds requiredPos, and hands the previous block to the worker for the
+ * window after it. Any other position stops the prefetch, as does a block sent to a peer or whose fd was handed out,
+ * which may still be mapped, and a transaction begun since, whose rows the prefetched window misses.
+ */
+bool SqliteSharedResultSet::TakePrefetchedBlock(int requiredPos)
+{
+    if (!prefetchThread.joinable()) {
+        return false;
+    }
+    if (rdbStoreImpl->IsInTransaction()) {
+        StopPrefetch();
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(prefetchMutex);
+    prefetchCondition.wait(lock, [this] { return prefetchState != PREFETCH_FILLING; });
+    if (prefetchState != PREFETCH_READY || GetBlock()->IsShared() || requiredPos < prefetchStartPos ||
+        requiredPos - prefetchStartPos >= static_cast<int>(prefetchBlock->GetRowNum())) {
+        lock.unlock();
+        StopPrefetch();
+        return false;
+    }
+
+    prefetchBlock = ExchangeBlock(prefetchBlock);
+    RecordBlockFilled();
+    int nextPos = prefetchStartPos + static_cast<int>(GetBlock()->GetRowNum());
+    if (nextPos >= rowNum) {
+        lock.unlock();
+        StopPrefetch();
+        return true;
+    }
+    prefetchStartPos = nextPos;
+    prefetchState = PREFETCH_FILLING;
+    lock.unlock();
+    prefetchCondition.notify_all();
+    return true;
+}
+
 void SqliteSharedResultSet::Finalize()
 {
     if (!AbsSharedResultSet::IsClosed()) {
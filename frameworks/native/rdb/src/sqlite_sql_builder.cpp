@@ -15,6 +15,7 @@
 
 #include "sqlite_sql_builder.h"
 
+#include <algorithm>
 #include <list>
 #include <regex>
 
@@ -43,12 +44,33 @@ std::string SqliteSqlBuilder::BuildDeleteString(const std::string &tableName, co
 }
 
 /**
- * Build a count SQL string using the given condition for SQLite.
+ * Build an update SQL string using the given condition for SQLite.
  */
 std::string SqliteSqlBuilder::BuildUpdateString(const ValuesBucket &values, const std::string &tableName,
     const std::vector<std::string> &whereArgs, const std::string &index, const std::string &whereClause,
     const std::string &group, const std::string &order, int limit, int offset, std::vector<ValueObject> &bindArgs,
     ConflictResolution conflictResolution)
+{
+    return BuildUpdateString(values, tableName, ToValueObjects(whereArgs), index, whereClause, group, order, limit,
+        offset, bindArgs, conflictResolution);
+}
+
+std::string SqliteSqlBuilder::BuildUpdateStringOnlyWhere(const ValuesBucket &values, const std::string &tableName,
+    const std::vector<std::string> &whereArgs, const std::string &index, const std::string &whereClause,
+    const std::string &group, const std::string &order, int limit, int offset, std::vector<ValueObject> &bindArgs,
+    ConflictResolution conflictResolution)
+{
+    return BuildUpdateStringOnlyWhere(values, tableName, ToValueObjects(whereArgs), index, whereClause, group, order,
+        limit, offset, bindArgs, conflictResolution);
+}
+
+/**
+ * Build an update SQL string, the typed where arguments are bound as they are.
+ */
+std::string SqliteSqlBuilder::BuildUpdateString(const ValuesBucket &values, const std::string &tableName,
+    const std::vector<ValueObject> &whereArgs, const std::string &index, const std::string &whereClause,
+    const std::string &group, const std::string &order, int limit, int offset, std::vector<ValueObject> &bindArgs,
+    ConflictResolution conflictResolution)
 {
     std::string sql;
 
@@ -57,25 +79,20 @@ std::string SqliteSqlBuilder::BuildUpdateString(const ValuesBucket &values, cons
         .append(" ")
         .append(tableName)
         .append(" SET ");
-    std::map<std::string, ValueObject> valuesMap;
-    values.GetAll(valuesMap);
-    for (auto iter = valuesMap.begin(); iter != valuesMap.end(); iter++) {
-        sql.append((iter == valuesMap.begin()) ? "" : ",");
-        sql.append(iter->first).append("=?");
-        bindArgs.push_back(iter->second);
-    }
-
-    if (!whereArgs.empty()) {
-        for (size_t i = 0; i < whereArgs.size(); i++) {
-            bindArgs.push_back(ValueObject(whereArgs[i]));
-        }
-    }
+    bool isFirst = true;
+    values.ForEach([&isFirst, &sql, &bindArgs](const std::string &column, const ValueObject &value) {
+        sql.append(isFirst ? "" : ",").append(column).append("=?");
+        bindArgs.push_back(value);
+        isFirst = false;
+    });
+
+    bindArgs.insert(bindArgs.end(), whereArgs.begin(), whereArgs.end());
     sql.append(BuildSqlStringFromPredicates(index, whereClause, group, order, limit, offset));
     return sql;
 }
 
 std::string SqliteSqlBuilder::BuildUpdateStringOnlyWhere(const ValuesBucket &values, const std::string &tableName,
-    const std::vector<std::string> &whereArgs, const std::string &index, const std::string &whereClause,
+    const std::vector<ValueObject> &whereArgs, const std::string &index, const std::string &whereClause,
     const std::string &group, const std::string &order, int limit, int offset, std::vector<ValueObject> &bindArgs,
     ConflictResolution conflictResolution)
 {
@@ -87,12 +104,7 @@ std::string SqliteSqlBuilder::BuildUpdateStringOnlyWhere(const ValuesBucket &val
         .append(tableName)
         .append(" SET ");
 
-    if (!whereArgs.empty()) {
-        for (size_t i = 0; i < whereArgs.size(); i++) {
-            bindArgs.push_back(ValueObject(whereArgs[i]));
-        }
-    }
-
+    bindArgs.insert(bindArgs.end(), whereArgs.begin(), whereArgs.end());
     sql.append(BuildSqlStringFromPredicates(index, whereClause, group, order, limit, offset));
     return sql;
 }
@@ -269,6 +281,69 @@ bool SqliteSqlBuilder::IsNotEmptyString(const std::string &str)
     return (!str.empty());
 }
 
+/**
+ * Builds "INSERT ... ON CONFLICT(conflictColumns) DO UPDATE SET column=excluded.column" for the columns of values,
+ * whose values are appended to bindArgs. The update takes the columns of values other than the conflict columns
+ * when updateColumns is empty, and becomes DO NOTHING when no column is left to update.
+ * @return an empty string if one of updateColumns is not a column of values
+ */
+std::string SqliteSqlBuilder::BuildUpsertString(const ValuesBucket &values, const std::string &tableName,
+    const std::vector<std::string> &conflictColumns, const std::vector<std::string> &updateColumns,
+    std::vector<ValueObject> &bindArgs)
+{
+    for (const auto &column : updateColumns) {
+        if (!values.HasColumn(column)) {
+            LOG_ERROR("update column %{public}s is not in the values", column.c_str());
+            return "";
+        }
+    }
+    std::string sql;
+    std::string placeholders;
+    std::vector<std::string> columns;
+    sql.append("INSERT INTO ").append(tableName).append("(");
+    values.ForEach([&sql, &placeholders, &columns, &bindArgs](const std::string &column, const ValueObject &value) {
+        sql.append(columns.empty() ? "" : ",").append(column);
+        placeholders.append(columns.empty() ? "?" : ",?");
+        columns.push_back(column);
+        bindArgs.push_back(value);
+    });
+    sql.append(") VALUES (").append(placeholders).append(") ON CONFLICT(");
+    for (size_t i = 0; i < conflictColumns.size(); i++) {
+        sql.append((i == 0) ? "" : ",").append(conflictColumns[i]);
+    }
+    sql.append(")");
+
+    std::vector<std::string> setColumns = updateColumns;
+    if (setColumns.empty()) {
+        for (auto &column : columns) {
+            if (std::find(conflictColumns.begin(), conflictColumns.end(), column) == conflictColumns.end()) {
+                setColumns.push_back(std::move(column));
+            }
+        }
+    }
+    if (setColumns.empty()) {
+        return sql.append(" DO NOTHING");
+    }
+    sql.append(" DO UPDATE SET ");
+    for (size_t i = 0; i < setColumns.size(); i++) {
+        sql.append((i == 0) ? "" : ",").append(setColumns[i]).append("=excluded.").append(setColumns[i]);
+    }
+    return sql;
+}
+
+/**
+ * Converts the text arguments of the string APIs into bind arguments.
+ */
+std::vector<ValueObject> SqliteSqlBuilder::ToValueObjects(const std::vector<std::string> &args)
+{
+    std::vector<ValueObject> valueObjects;
+    valueObjects.reserve(args.size());
+    for (const auto &arg : args) {
+        valueObjects.emplace_back(arg);
+    }
+    return valueObjects;
+}
+
 std::string SqliteSqlBuilder::BuildQueryString(const AbsRdbPredicates &predicates,
     const std::vector<std::string> &columns)
 {
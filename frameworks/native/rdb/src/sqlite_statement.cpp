@@ -77,38 +77,42 @@ int SqliteStatement::Finalize()
     return E_OK;
 }
 
-int SqliteStatement::BindArguments(const std::vector<ValueObject> &bindArgs) const
+/**
+ * Binds the arguments to the statement, the parameters beyond them are bound to null. The strings and blobs are
+ * bound without copying when isArgsPinned is true, so the caller must keep bindArgs unchanged until the statement
+ * has been reset.
+ */
+int SqliteStatement::BindArguments(const std::vector<ValueObject> &bindArgs, bool isArgsPinned) const
 {
     int count = static_cast<int>(bindArgs.size());
-    std::vector<ValueObject> abindArgs;
+    if (count > numParameters) {
+        return E_INVALID_BIND_ARGS_COUNT;
+    }
 
     if (count == 0) {
         return E_OK;
     }
-    // Obtains the bound parameter set.
-    if ((numParameters != 0) && (count <= numParameters)) {
-        for (const auto& i : bindArgs) {
-            abindArgs.push_back(i);
-        }
 
-        for (int i = count; i < numParameters; i++) {
-            ValueObject val;
-            abindArgs.push_back(val);
-        }
+    int errCode = InnerBindArguments(bindArgs, isArgsPinned);
+    if (errCode != E_OK) {
+        return errCode;
     }
 
-    if (count > numParameters) {
-        return E_INVALID_BIND_ARGS_COUNT;
+    for (int index = count + 1; index <= numParameters; index++) {
+        errCode = sqlite3_bind_null(stmtHandle, index);
+        if (errCode != SQLITE_OK) {
+            return SQLiteError::ErrNo(errCode);
+        }
     }
-
-    return InnerBindArguments(abindArgs);
+    return E_OK;
 }
 
-int SqliteStatement::InnerBindArguments(const std::vector<ValueObject> &bindArgs) const
+int SqliteStatement::InnerBindArguments(const std::vector<ValueObject> &bindArgs, bool isArgsPinned) const
 {
+    auto destructor = isArgsPinned ? SQLITE_STATIC : SQLITE_TRANSIENT;
     int index = 1;
     int errCode;
-    for (auto arg : bindArgs) {
+    for (const auto &arg : bindArgs) {
         switch (arg.GetType()) {
             case ValueObjectType::TYPE_NULL: {
                 errCode = sqlite3_bind_null(stmtHandle, index);
@@ -127,10 +131,10 @@ int SqliteStatement::InnerBindArguments(const std::vector<ValueObject> &bindArgs
                 break;
             }
             case ValueObjectType::TYPE_BLOB: {
-                std::vector<uint8_t> blob;
-                arg.GetBlob(blob);
-                errCode = sqlite3_bind_blob(stmtHandle, index, static_cast<const void *>(blob.data()), blob.size(),
-                    SQLITE_TRANSIENT);
+                const uint8_t *blob = nullptr;
+                size_t size = 0;
+                arg.GetBlobView(blob, size);
+                errCode = sqlite3_bind_blob64(stmtHandle, index, static_cast<const void *>(blob), size, destructor);
                 break;
             }
             case ValueObjectType::TYPE_BOOL: {
@@ -140,9 +144,9 @@ int SqliteStatement::InnerBindArguments(const std::vector<ValueObject> &bindArgs
                 break;
             }
             default: {
-                std::string str;
-                arg.GetString(str);
-                errCode = sqlite3_bind_text(stmtHandle, index, str.c_str(), str.length(), SQLITE_TRANSIENT);
+                std::string_view str;
+                arg.GetStringView(str);
+                errCode = sqlite3_bind_text64(stmtHandle, index, str.data(), str.length(), destructor, SQLITE_UTF8);
                 break;
             }
         }
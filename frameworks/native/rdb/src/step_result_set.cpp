@@ -27,7 +27,7 @@
 namespace OHOS {
 namespace NativeRdb {
 StepResultSet::StepResultSet(
-    std::shared_ptr<RdbStoreImpl> rdb, const std::string &sql, const std::vector<std::string> &selectionArgs)
+    std::shared_ptr<RdbStoreImpl> rdb, const std::string &sql, const std::vector<ValueObject> &selectionArgs)
     : rdb(rdb), sql(sql), selectionArgs(selectionArgs), isAfterLast(false), rowCount(INIT_POS),
       sqliteStatement(nullptr)
 {
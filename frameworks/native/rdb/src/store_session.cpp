@@ -34,13 +34,19 @@ StoreSession::~StoreSession()
 {
 }
 
-void StoreSession::AcquireConnection(bool isReadOnly)
+int StoreSession::AcquireConnection(bool isReadOnly)
 {
     if (connection == nullptr) {
-        connection = connectionPool.AcquireConnection(isReadOnly);
+        int errCode = E_OK;
+        connection = connectionPool.AcquireConnection(isReadOnly, errCode);
+        if (connection == nullptr) {
+            LOG_ERROR("StoreSession AcquireConnection failed %{public}d", errCode);
+            return errCode;
+        }
     }
 
     connectionUseCount += 1;
+    return E_OK;
 }
 
 void StoreSession::ReleaseConnection()
@@ -66,8 +72,11 @@ int StoreSession::PrepareAndGetInfo(
     }
     bool assumeReadOnly = SqliteUtils::IsSqlReadOnly(type);
 
-    AcquireConnection(assumeReadOnly);
-    int errCode = connection->PrepareAndGetInfo(sql, outIsReadOnly, numParameters, columnNames);
+    int errCode = AcquireConnection(assumeReadOnly);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    errCode = connection->PrepareAndGetInfo(sql, outIsReadOnly, numParameters, columnNames);
     if (errCode != 0) {
         ReleaseConnection();
         return errCode;
@@ -86,8 +95,11 @@ int StoreSession::BeginExecuteSql(const std::string &sql)
 
     bool assumeReadOnly = SqliteUtils::IsSqlReadOnly(type);
     bool isReadOnly = false;
-    AcquireConnection(assumeReadOnly);
-    int errCode = connection->Prepare(sql, isReadOnly);
+    int errCode = AcquireConnection(assumeReadOnly);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    errCode = connection->Prepare(sql, isReadOnly);
     if (errCode != 0) {
         ReleaseConnection();
         return errCode;
@@ -95,7 +107,10 @@ int StoreSession::BeginExecuteSql(const std::string &sql)
 
     if (isReadOnly == connection->IsWriteConnection()) {
         ReleaseConnection();
-        AcquireConnection(isReadOnly);
+        errCode = AcquireConnection(isReadOnly);
+        if (errCode != E_OK) {
+            return errCode;
+        }
         if (!isReadOnly && !connection->IsWriteConnection()) {
             LOG_ERROR("StoreSession BeginExecutea : read connection can not execute write operation");
             ReleaseConnection();
@@ -159,6 +174,153 @@ int StoreSession::ExecuteGetLong(int64_t &outValue, const std::string &sql, cons
     return errCode;
 }
 
+/**
+ * Executes a pinned sql on a connection of the kind it was classified for when it was prepared.
+ */
+int StoreSession::ExecutePinned(const std::shared_ptr<const PinnedSql> &pinnedSql,
+    const std::vector<ValueObject> &bindArgs, PinnedSql::ResultType resultType, int64_t &outValue)
+{
+    int errCode = AcquireConnection(pinnedSql->isReadOnly);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    if (!pinnedSql->isReadOnly && !connection->IsWriteConnection()) {
+        LOG_ERROR("StoreSession ExecutePinned : read connection can not execute write operation");
+        ReleaseConnection();
+        return E_EXECUTE_WRITE_IN_READ_CONNECTION;
+    }
+
+    errCode = connection->ExecutePinned(pinnedSql, bindArgs, resultType, outValue);
+    ReleaseConnection();
+    return errCode;
+}
+
+/**
+ * Executes every statement of the batch with each of its bind argument sets inside one transaction,
+ * or inside a savepoint when a transaction is already open. Nothing is applied if any row fails. rowChanges,
+ * when given, receives the changes of every bind argument set in the order of the batch.
+ */
+int StoreSession::ExecuteBatch(int64_t &outChangedRows, const BatchSqls &batch, std::vector<int64_t> *rowChanges)
+{
+    int errCode = AcquireConnection(false);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    if (!connection->IsWriteConnection()) {
+        LOG_ERROR("StoreSession ExecuteBatch : read connection can not execute write operation");
+        ReleaseConnection();
+        return E_EXECUTE_WRITE_IN_READ_CONNECTION;
+    }
+
+    BaseTransaction transaction(connectionPool.getTransactionStack().size());
+    errCode = connection->ExecuteSql(transaction.getTransactionStr());
+    if (errCode != E_OK) {
+        ReleaseConnection();
+        return errCode;
+    }
+
+    int64_t changedRows = 0;
+    std::vector<int64_t> changesList;
+    std::vector<int64_t> *changesOut = (rowChanges == nullptr) ? nullptr : &changesList;
+    for (const auto &[sql, bindArgsList] : batch) {
+        int64_t changes = 0;
+        errCode = connection->ExecuteBatch(changes, sql, bindArgsList, changesOut);
+        if (errCode != E_OK) {
+            LOG_ERROR("StoreSession ExecuteBatch failed %{public}d", errCode);
+            break;
+        }
+        changedRows += changes;
+    }
+
+    if (errCode != E_OK) {
+        connection->ExecuteSql(transaction.getRollbackStr());
+        ReleaseConnection();
+        return errCode;
+    }
+
+    std::string commitSql = transaction.getCommitStr();
+    if (commitSql.size() > 1) {
+        errCode = connection->ExecuteSql(commitSql);
+    }
+    ReleaseConnection();
+    if (errCode == E_OK) {
+        outChangedRows = changedRows;
+        if (rowChanges != nullptr) {
+            *rowChanges = std::move(changesList);
+        }
+    }
+    return errCode;
+}
+
+/**
+ * Executes the writes collected by the group commit queue in one transaction, each write gets its own result.
+ * A write failing with an error that rolls back the whole transaction fails the writes before it as well,
+ * the remaining writes go on in a new transaction.
+ */
+void StoreSession::ExecuteGroup(std::vector<GroupCommitQueue::WriteRequest *> &batch)
+{
+    int errCode = AcquireConnection(false);
+    if (errCode != E_OK) {
+        for (auto request : batch) {
+            request->errCode = errCode;
+        }
+        return;
+    }
+
+    BaseTransaction transaction(connectionPool.getTransactionStack().size());
+    size_t first = 0;
+    while (first < batch.size()) {
+        errCode = connection->ExecuteSql(transaction.getTransactionStr());
+        if (errCode != E_OK) {
+            break;
+        }
+
+        size_t next = first;
+        for (; next < batch.size(); next++) {
+            GroupCommitQueue::WriteRequest *request = batch[next];
+            if (request->isInsert) {
+                request->errCode =
+                    connection->ExecuteForLastInsertedRowId(request->result, *request->sql, *request->bindArgs);
+            } else {
+                int changedRows = 0;
+                request->errCode =
+                    connection->ExecuteForChangedRowCount(changedRows, *request->sql, *request->bindArgs);
+                request->result = changedRows;
+            }
+            if (request->errCode != E_OK && !connection->IsInTransaction()) {
+                break;
+            }
+        }
+
+        if (next < batch.size()) {
+            LOG_ERROR("StoreSession ExecuteGroup : transaction rolled back by %{public}d", batch[next]->errCode);
+            for (size_t i = first; i < next; i++) {
+                batch[i]->errCode = batch[next]->errCode;
+            }
+            first = next + 1;
+            continue;
+        }
+
+        std::string commitSql = transaction.getCommitStr();
+        if (commitSql.size() > 1) {
+            errCode = connection->ExecuteSql(commitSql);
+        }
+        if (errCode != E_OK) {
+            LOG_ERROR("StoreSession ExecuteGroup : commit failed %{public}d", errCode);
+            connection->ExecuteSql(transaction.getRollbackStr());
+            for (size_t i = first; i < next; i++) {
+                batch[i]->errCode = (batch[i]->errCode == E_OK) ? errCode : batch[i]->errCode;
+            }
+        }
+        first = next;
+    }
+
+    for (size_t i = first; i < batch.size(); i++) {
+        batch[i]->errCode = errCode;
+    }
+    ReleaseConnection();
+}
+
 int StoreSession::ExecuteGetString(
     std::string &outValue, const std::string &sql, const std::vector<ValueObject> &bindArgs)
 {
@@ -170,7 +332,10 @@ int StoreSession::ExecuteGetString(
     int type = SqliteDatabaseUtils::GetSqlStatementType(sqlstr);
     if (type == STATEMENT_PRAGMA) {
         ReleaseConnection();
-        AcquireConnection(false);
+        errCode = AcquireConnection(false);
+        if (errCode != E_OK) {
+            return errCode;
+        }
     }
     errCode = connection->ExecuteGetString(outValue, sql, bindArgs);
     ReleaseConnection();
@@ -285,14 +450,17 @@ int StoreSession::Attach(
 int StoreSession::BeginTransaction(TransactionObserver *transactionObserver)
 {
     if (connectionPool.getTransactionStack().empty()) {
-        AcquireConnection(false);
+        int errCode = AcquireConnection(false);
+        if (errCode != E_OK) {
+            return errCode;
+        }
         if (!connection->IsWriteConnection()) {
             LOG_ERROR("StoreSession BeginExecutea : read connection can not begin transaction");
             ReleaseConnection();
             return E_BEGIN_TRANSACTION_IN_READ_CONNECTION;
         }
 
-        int errCode = connection->ExecuteSql("BEGIN EXCLUSIVE;");
+        errCode = connection->ExecuteSql("BEGIN EXCLUSIVE;");
         if (errCode != E_OK) {
             ReleaseConnection();
             return errCode;
@@ -395,7 +563,7 @@ bool StoreSession::IsInTransaction() const
 }
 
 std::shared_ptr<SqliteStatement> StoreSession::BeginStepQuery(
-    int &errCode, const std::string &sql, const std::vector<std::string> &selectionArgs)
+    int &errCode, const std::string &sql, const std::vector<ValueObject> &selectionArgs)
 {
     if (isInStepQuery == true) {
         LOG_ERROR("StoreSession BeginStepQuery fail : begin more step query in one session !");
@@ -409,7 +577,10 @@ std::shared_ptr<SqliteStatement> StoreSession::BeginStepQuery(
         return nullptr;
     }
 
-    AcquireConnection(true);
+    errCode = AcquireConnection(true);
+    if (errCode != E_OK) {
+        return nullptr;
+    }
     std::shared_ptr<SqliteStatement> statement = connection->BeginStepQuery(errCode, sql, selectionArgs);
     if (statement == nullptr) {
         ReleaseConnection();
@@ -446,10 +617,13 @@ int StoreSession::ExecuteForSharedBlock(int &rowNum, std::string sql, const std:
 
 int StoreSession::BeginTransaction()
 {
-    AcquireConnection(false);
+    int errCode = AcquireConnection(false);
+    if (errCode != E_OK) {
+        return errCode;
+    }
 
     BaseTransaction transaction(connectionPool.getTransactionStack().size());
-    int errCode = connection->ExecuteSql(transaction.getTransactionStr());
+    errCode = connection->ExecuteSql(transaction.getTransactionStr());
     if (errCode != E_OK) {
         LOG_DEBUG("storeSession BeginTransaction Failed");
         ReleaseConnection();
@@ -472,8 +646,11 @@ int StoreSession::Commit()
         return E_OK;
     }
 
-    AcquireConnection(false);
-    int errCode = connection->ExecuteSql(sqlStr);
+    int errCode = AcquireConnection(false);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    errCode = connection->ExecuteSql(sqlStr);
     ReleaseConnection();
     if (errCode != E_OK) {
         // if error the transaction is leaving for rollback
@@ -494,8 +671,11 @@ int StoreSession::RollBack()
     if (transaction.getType() != TransType::ROLLBACK_SELF && !transactionStack.empty()) {
         transactionStack.top().setChildFailure(true);
     }
-    AcquireConnection(false);
-    int errCode = connection->ExecuteSql(transaction.getRollbackStr());
+    int errCode = AcquireConnection(false);
+    if (errCode != E_OK) {
+        return errCode;
+    }
+    errCode = connection->ExecuteSql(transaction.getRollbackStr());
     ReleaseConnection();
     if (errCode != E_OK) {
         LOG_ERROR("storeSession RollBack Fail");
@@ -15,8 +15,14 @@
 
 #include "string_utils.h"
 
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
 namespace OHOS {
 namespace NativeRdb {
+// Digits needed for a double to survive a round trip through text
+const int ROUND_TRIP_PRECISION = 17;
 std::string StringUtils::SurroundWithQuote(std::string value, std::string quote)
 {
     if (value.empty()) {
@@ -45,6 +51,107 @@ std::string StringUtils::SurroundWithFunction(std::string function, std::string
     return builder;
 }
 
+// Obtains the text form of a bind argument, reals keep every digit needed to read them back unchanged.
+std::string StringUtils::ToString(const ValueObject &value)
+{
+    switch (value.GetType()) {
+        case ValueObjectType::TYPE_INT: {
+            int64_t longVal = 0;
+            value.GetLong(longVal);
+            return std::to_string(longVal);
+        }
+        case ValueObjectType::TYPE_DOUBLE: {
+            double doubleVal = 0;
+            value.GetDouble(doubleVal);
+            std::ostringstream os;
+            os << std::setprecision(ROUND_TRIP_PRECISION) << doubleVal;
+            return os.str();
+        }
+        case ValueObjectType::TYPE_BOOL: {
+            bool boolVal = false;
+            value.GetBool(boolVal);
+            return boolVal ? "1" : "0";
+        }
+        case ValueObjectType::TYPE_STRING: {
+            std::string strVal;
+            value.GetString(strVal);
+            return strVal;
+        }
+        case ValueObjectType::TYPE_BLOB: {
+            std::vector<uint8_t> blobVal;
+            value.GetBlob(blobVal);
+            return std::string(blobVal.begin(), blobVal.end());
+        }
+        default:
+            return "";
+    }
+}
+
+static void AppendJsonString(std::string &json, std::string_view text)
+{
+    static const char *hexDigits = "0123456789abcdef";
+    json += '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            json += '\\';
+            json += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            json += "\\u00";
+            json += hexDigits[(c >> 4) & 0xf];
+            json += hexDigits[c & 0xf];
+        } else {
+            json += c;
+        }
+    }
+    json += '"';
+}
+
+// Encode values as a JSON array for json_each(). Blobs and non-finite doubles have no JSON form.
+bool StringUtils::ToJsonArray(const std::vector<ValueObject> &values, std::string &json)
+{
+    json = "[";
+    for (size_t i = 0; i < values.size(); i++) {
+        if (i != 0) {
+            json += ',';
+        }
+        const ValueObject &value = values[i];
+        switch (value.GetType()) {
+            case ValueObjectType::TYPE_NULL:
+                json += "null";
+                break;
+            case ValueObjectType::TYPE_DOUBLE: {
+                double doubleVal = 0;
+                value.GetDouble(doubleVal);
+                if (!std::isfinite(doubleVal)) {
+                    return false;
+                }
+                std::ostringstream os;
+                os << std::setprecision(ROUND_TRIP_PRECISION) << doubleVal;
+                std::string text = os.str();
+                // keep the value a real once json_each() reads it back
+                if (text.find_first_of(".e") == std::string::npos) {
+                    text += ".0";
+                }
+                json += text;
+                break;
+            }
+            case ValueObjectType::TYPE_STRING: {
+                std::string_view strVal;
+                value.GetStringView(strVal);
+                AppendJsonString(json, strVal);
+                break;
+            }
+            case ValueObjectType::TYPE_BLOB:
+                return false;
+            default:
+                json += ToString(value);
+                break;
+        }
+    }
+    json += ']';
+    return true;
+}
+
 StringUtils::StringUtils() {}
 StringUtils::~StringUtils() {}
 } // namespace NativeRdb
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "task_scheduler.h"
+
+namespace OHOS {
+namespace NativeRdb {
+TaskScheduler &TaskScheduler::GetInstance()
+{
+    // never destroyed, stores may still remove their tasks while the process exits
+    static TaskScheduler *instance = new TaskScheduler();
+    return *instance;
+}
+
+TaskScheduler::TaskScheduler() : nextTaskId(INVALID_TASK_ID + 1), runningTaskId(INVALID_TASK_ID)
+{
+    std::thread worker([this] { Run(); });
+    worker.detach();
+}
+
+/**
+ * Runs the task on the worker thread once the delay has passed.
+ */
+TaskScheduler::TaskId TaskScheduler::Schedule(std::chrono::milliseconds delay, Task task)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    TaskId taskId = nextTaskId++;
+    Clock::time_point time = Clock::now() + delay;
+    timeline.emplace(time, taskId);
+    tasks.emplace(taskId, std::make_pair(time, std::move(task)));
+    taskCondition.notify_one();
+    return taskId;
+}
+
+/**
+ * Cancels a scheduled task, waiting for it to finish if it is running. Must not be called from the task itself.
+ */
+void TaskScheduler::Remove(TaskId taskId)
+{
+    if (taskId == INVALID_TASK_ID) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mutex);
+    auto iter = tasks.find(taskId);
+    if (iter != tasks.end()) {
+        auto range = timeline.equal_range(iter->second.first);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == taskId) {
+                timeline.erase(it);
+                break;
+            }
+        }
+        tasks.erase(iter);
+    }
+    finishCondition.wait(lock, [this, taskId] { return runningTaskId != taskId; });
+}
+
+void TaskScheduler::Run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        if (timeline.empty()) {
+            taskCondition.wait(lock);
+            continue;
+        }
+        auto first = timeline.begin();
+        if (first->first > Clock::now()) {
+            taskCondition.wait_until(lock, first->first);
+            continue;
+        }
+
+        TaskId taskId = first->second;
+        timeline.erase(first);
+        auto iter = tasks.find(taskId);
+        Task task = std::move(iter->second.second);
+        tasks.erase(iter);
+
+        runningTaskId = taskId;
+        lock.unlock();
+        task();
+        lock.lock();
+        runningTaskId = INVALID_TASK_ID;
+        finishCondition.notify_all();
+    }
+}
+} // namespace NativeRdb
+} // namespace OHOS
@@ -70,8 +70,7 @@ ValueObject::ValueObject(const std::string &val) : type(ValueObjectType::TYPE_ST
 }
 ValueObject::ValueObject(const std::vector<uint8_t> &val) : type(ValueObjectType::TYPE_BLOB)
 {
-    std::vector<uint8_t> blob = val;
-    value = blob;
+    value = val;
 }
 
 ValueObject &ValueObject::operator=(ValueObject &&valueObject) noexcept
@@ -161,6 +160,28 @@ int ValueObject::GetBlob(std::vector<uint8_t> &val) const
     return E_OK;
 }
 
+int ValueObject::GetStringView(std::string_view &val) const
+{
+    if (type != ValueObjectType::TYPE_STRING) {
+        return E_INVALID_OBJECT_TYPE;
+    }
+
+    val = std::get<std::string>(value);
+    return E_OK;
+}
+
+int ValueObject::GetBlobView(const uint8_t *&data, size_t &size) const
+{
+    if (type != ValueObjectType::TYPE_BLOB) {
+        return E_INVALID_OBJECT_TYPE;
+    }
+
+    const auto &blob = std::get<std::vector<uint8_t>>(value);
+    data = blob.data();
+    size = blob.size();
+    return E_OK;
+}
+
 bool ValueObject::Marshalling(Parcel &parcel) const
 {
     switch (this->type) {
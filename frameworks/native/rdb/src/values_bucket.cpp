@@ -15,13 +15,17 @@
 
 #include "values_bucket.h"
 
+#include <algorithm>
+#include <memory>
+
 namespace OHOS {
 namespace NativeRdb {
 ValuesBucket::ValuesBucket()
 {
 }
 
-ValuesBucket::ValuesBucket(std::map<std::string, ValueObject> &valuesMap) : valuesMap(valuesMap)
+ValuesBucket::ValuesBucket(std::map<std::string, ValueObject> &valuesMap)
+    : columns(valuesMap.begin(), valuesMap.end())
 {
 }
 
@@ -29,74 +33,100 @@ ValuesBucket::~ValuesBucket()
 {
 }
 
+/**
+ * Inserts the column at its sorted position. A column that is already present keeps its value.
+ */
+void ValuesBucket::Put(const std::string &columnName, ValueObject &&value)
+{
+    auto iter = std::lower_bound(columns.begin(), columns.end(), columnName,
+        [](const Column &column, const std::string &name) { return column.first < name; });
+    if (iter != columns.end() && iter->first == columnName) {
+        return;
+    }
+    if (columns.capacity() == 0) {
+        columns.reserve(DEFAULT_CAPACITY);
+        iter = columns.end();
+    }
+    columns.emplace(iter, columnName, std::move(value));
+}
+
+std::vector<ValuesBucket::Column>::const_iterator ValuesBucket::Find(const std::string &columnName) const
+{
+    auto iter = std::lower_bound(columns.begin(), columns.end(), columnName,
+        [](const Column &column, const std::string &name) { return column.first < name; });
+    if (iter != columns.end() && iter->first == columnName) {
+        return iter;
+    }
+    return columns.end();
+}
+
 void ValuesBucket::PutString(const std::string &columnName, const std::string &value)
 {
-    valuesMap.insert(std::make_pair(columnName, ValueObject(value)));
+    Put(columnName, ValueObject(value));
 }
 
 void ValuesBucket::PutInt(const std::string &columnName, int value)
 {
-    valuesMap.insert(std::make_pair(columnName, ValueObject(value)));
+    Put(columnName, ValueObject(value));
 }
 
 void ValuesBucket::PutLong(const std::string &columnName, int64_t value)
 {
-    valuesMap.insert(std::make_pair(columnName, ValueObject(value)));
+    Put(columnName, ValueObject(value));
 }
 
 void ValuesBucket::PutDouble(const std::string &columnName, double value)
 {
-    valuesMap.insert(std::make_pair(columnName, ValueObject(value)));
+    Put(columnName, ValueObject(value));
 }
 
 void ValuesBucket::PutBool(const std::string &columnName, bool value)
 {
-    valuesMap.insert(std::make_pair(columnName, ValueObject(value)));
+    Put(columnName, ValueObject(value));
 }
 
 void ValuesBucket::PutBlob(const std::string &columnName, const std::vector<uint8_t> &value)
 {
-    valuesMap.insert(std::make_pair(columnName, ValueObject(value)));
+    Put(columnName, ValueObject(value));
 }
 
 void ValuesBucket::PutNull(const std::string &columnName)
 {
-    valuesMap.insert(std::make_pair(columnName, ValueObject()));
+    Put(columnName, ValueObject());
 }
 
 void ValuesBucket::Delete(const std::string &columnName)
 {
-    valuesMap.erase(columnName);
+    auto iter = Find(columnName);
+    if (iter != columns.end()) {
+        columns.erase(iter);
+    }
 }
 
 void ValuesBucket::Clear()
 {
-    valuesMap.clear();
+    columns.clear();
 }
 
 int ValuesBucket::Size() const
 {
-    return valuesMap.size();
+    return columns.size();
 }
 
 bool ValuesBucket::IsEmpty() const
 {
-    return valuesMap.empty();
+    return columns.empty();
 }
 
 bool ValuesBucket::HasColumn(const std::string &columnName) const
 {
-    auto iter = valuesMap.find(columnName);
-    if (iter == valuesMap.end()) {
-        return false;
-    }
-    return true;
+    return Find(columnName) != columns.end();
 }
 
 bool ValuesBucket::GetObject(const std::string &columnName, ValueObject &value) const
 {
-    auto iter = valuesMap.find(columnName);
-    if (iter == valuesMap.end()) {
+    auto iter = Find(columnName);
+    if (iter == columns.end()) {
         return false;
     }
     value = iter->second;
@@ -105,15 +135,25 @@ bool ValuesBucket::GetObject(const std::string &columnName, ValueObject &value)
 
 void ValuesBucket::GetAll(std::map<std::string, ValueObject> &outValuesMap) const
 {
-    outValuesMap = valuesMap;
+    outValuesMap.clear();
+    for (auto &column : columns) {
+        outValuesMap.emplace_hint(outValuesMap.end(), column.first, column.second);
+    }
+}
+
+void ValuesBucket::ForEach(const std::function<void(const std::string &, const ValueObject &)> &visitor) const
+{
+    for (auto &column : columns) {
+        visitor(column.first, column.second);
+    }
 }
 
 bool ValuesBucket::Marshalling(Parcel &parcel) const
 {
-    parcel.WriteInt32(valuesMap.size());
-    for (auto &it : valuesMap) {
-        parcel.WriteString(it.first);
-        parcel.WriteParcelable(&it.second);
+    parcel.WriteInt32(columns.size());
+    for (auto &column : columns) {
+        parcel.WriteString(column.first);
+        parcel.WriteParcelable(&column.second);
     }
     return true;
 }
@@ -121,15 +161,16 @@ bool ValuesBucket::Marshalling(Parcel &parcel) const
 ValuesBucket *ValuesBucket::Unmarshalling(Parcel &parcel)
 {
     int mapSize = parcel.ReadInt32();
-    std::map<std::string, ValueObject> valuesMap;
-    ValueObject *value = nullptr;
+    ValuesBucket *valuesBucket = new ValuesBucket();
     for (int i = 0; i < mapSize; i++) {
         std::string key = parcel.ReadString();
-        value = parcel.ReadParcelable<ValueObject>();
-        valuesMap.insert(std::make_pair(key, *value));
+        std::unique_ptr<ValueObject> value(parcel.ReadParcelable<ValueObject>());
+        if (value == nullptr) {
+            break;
+        }
+        valuesBucket->Put(key, std::move(*value));
     }
-    value = nullptr;
-    return new ValuesBucket(valuesMap);
+    return valuesBucket;
 }
 } // namespace NativeRdb
 } // namespace OHOS
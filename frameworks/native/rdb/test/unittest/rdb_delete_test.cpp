@@ -255,3 +255,52 @@ HWTEST_F(RdbDeleteTest, RdbStore_Delete_003, TestSize.Level1)
     EXPECT_EQ(ret, E_OK);
     EXPECT_EQ(deletedRows, 1);
 }
+
+/**
+ * @tc.name: RdbStore_BatchDelete_001
+ * @tc.desc: test RdbStore BatchDelete, the count of each predicates in one transaction
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbDeleteTest, RdbStore_BatchDelete_001, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbDeleteTest::store;
+
+    int64_t id;
+    ValuesBucket values;
+    for (int i = 1; i <= 5; i++) {
+        values.Clear();
+        values.PutInt("id", i);
+        values.PutString("name", "name" + std::to_string(i));
+        values.PutInt("age", 18 + i);
+        EXPECT_EQ(store->Insert(id, "test", values), E_OK);
+    }
+
+    std::vector<AbsRdbPredicates> predicates;
+    for (int i = 1; i <= 2; i++) {
+        AbsRdbPredicates item("test");
+        item.EqualTo("id", std::to_string(i));
+        predicates.push_back(item);
+    }
+    AbsRdbPredicates older("test");
+    older.GreaterThan("age", "21");
+    predicates.push_back(older);
+    AbsRdbPredicates missing("test");
+    missing.EqualTo("id", "1");
+    predicates.push_back(missing);
+
+    std::vector<int64_t> deletedRows;
+    int ret = store->BatchDelete(deletedRows, predicates);
+    EXPECT_EQ(ret, E_OK);
+    EXPECT_EQ(deletedRows, (std::vector<int64_t>{ 1, 1, 2, 0 }));
+
+    int64_t count = 0;
+    ret = store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test");
+    EXPECT_EQ(ret, E_OK);
+    EXPECT_EQ(count, 1);
+
+    predicates.clear();
+    predicates.push_back(AbsRdbPredicates(""));
+    ret = store->BatchDelete(deletedRows, predicates);
+    EXPECT_EQ(ret, E_EMPTY_TABLE_NAME);
+    EXPECT_TRUE(deletedRows.empty());
+}
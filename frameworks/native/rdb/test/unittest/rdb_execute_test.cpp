@@ -242,3 +242,93 @@ HWTEST_F(RdbExecuteTest, RdbStore_Execute_003, TestSize.Level1)
     EXPECT_EQ(ret, E_OK);
     EXPECT_EQ(journalMode, "wal");
 }
+
+/**
+ * @tc.name: RdbStore_Execute_004
+ * @tc.desc: test RdbStore Execute, queries see the new schema after DDL
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbExecuteTest, RdbStore_Execute_004, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbExecuteTest::store;
+
+    int ret = store->ExecuteSql("CREATE TABLE IF NOT EXISTS schema_test (id INTEGER PRIMARY KEY, name TEXT)");
+    EXPECT_EQ(ret, E_OK);
+
+    int columnCount = 0;
+    std::unique_ptr<ResultSet> resultSet = store->QuerySql("SELECT * FROM schema_test");
+    ASSERT_NE(resultSet, nullptr);
+    EXPECT_EQ(resultSet->GetColumnCount(columnCount), E_OK);
+    EXPECT_EQ(columnCount, 2);
+    resultSet->Close();
+
+    ret = store->ExecuteSql("ALTER TABLE schema_test ADD COLUMN age INTEGER");
+    EXPECT_EQ(ret, E_OK);
+
+    resultSet = store->QuerySql("SELECT * FROM schema_test");
+    ASSERT_NE(resultSet, nullptr);
+    EXPECT_EQ(resultSet->GetColumnCount(columnCount), E_OK);
+    EXPECT_EQ(columnCount, 3);
+    resultSet->Close();
+
+    ret = store->ExecuteSql("DROP TABLE IF EXISTS schema_test");
+    EXPECT_EQ(ret, E_OK);
+}
+
+/**
+ * @tc.name: RdbStore_Execute_005
+ * @tc.desc: test RdbStore Prepare, a prepared statement executed repeatedly with new bound values
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbExecuteTest, RdbStore_Execute_005, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbExecuteTest::store;
+
+    int errCode = E_OK;
+    std::shared_ptr<RdbStatement> insert = store->Prepare(errCode, "INSERT INTO test (name, age) VALUES (?, ?)");
+    ASSERT_NE(insert, nullptr);
+    EXPECT_EQ(errCode, E_OK);
+    EXPECT_EQ(insert->GetParameterCount(), 2);
+    EXPECT_FALSE(insert->IsReadOnly());
+    int64_t lastId = 0;
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(insert->Bind(0, ValueObject(std::string("zhangsan"))), E_OK);
+        EXPECT_EQ(insert->Bind(1, ValueObject(18 + i)), E_OK);
+        int64_t id = 0;
+        EXPECT_EQ(insert->ExecuteForLastInsertedRowId(id), E_OK);
+        EXPECT_GT(id, lastId);
+        lastId = id;
+    }
+    EXPECT_EQ(insert->Bind(2, ValueObject(1)), E_INVALID_BIND_ARGS_COUNT);
+
+    std::shared_ptr<RdbStatement> count = store->Prepare(errCode, "SELECT COUNT(*) FROM test WHERE age >= ?");
+    ASSERT_NE(count, nullptr);
+    EXPECT_TRUE(count->IsReadOnly());
+    EXPECT_EQ(count->BindArgs({ ValueObject(19) }), E_OK);
+    int64_t rows = 0;
+    EXPECT_EQ(count->ExecuteGetLong(rows), E_OK);
+    EXPECT_EQ(rows, 2);
+
+    std::unique_ptr<AbsSharedResultSet> resultSet = count->Query();
+    ASSERT_NE(resultSet, nullptr);
+    EXPECT_EQ(resultSet->GoToFirstRow(), E_OK);
+    int value = 0;
+    EXPECT_EQ(resultSet->GetInt(0, value), E_OK);
+    EXPECT_EQ(value, 2);
+    resultSet->Close();
+
+    std::shared_ptr<RdbStatement> update = store->Prepare(errCode, "UPDATE test SET age = age + 1 WHERE age < ?");
+    ASSERT_NE(update, nullptr);
+    EXPECT_EQ(update->BindArgs({ ValueObject(20) }), E_OK);
+    int64_t changedRows = 0;
+    EXPECT_EQ(update->ExecuteForChangedRowCount(changedRows), E_OK);
+    EXPECT_EQ(changedRows, 2);
+    EXPECT_EQ(update->Execute(), E_OK);
+
+    EXPECT_EQ(store->Prepare(errCode, "BEGIN TRANSACTION"), nullptr);
+    EXPECT_NE(errCode, E_OK);
+}
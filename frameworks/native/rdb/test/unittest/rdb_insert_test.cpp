@@ -689,3 +689,184 @@ HWTEST_F(RdbStoreInsertTest, RdbStore_InsertWithConflictResolution_006_007, Test
     ret = resultSet->Close();
     EXPECT_EQ(ret, E_OK);
 }
+
+/**
+ * @tc.name: RdbStore_BatchInsert_001
+ * @tc.desc: test RdbStore BatchInsert with rows of different column sets
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbStoreInsertTest, RdbStore_BatchInsert_001, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbStoreInsertTest::store;
+
+    std::vector<ValuesBucket> valuesBuckets;
+    for (int i = 0; i < 100; i++) {
+        ValuesBucket values;
+        values.PutString("name", "zhangsan" + std::to_string(i));
+        values.PutInt("age", i);
+        if (i % 2 == 0) {
+            values.PutDouble("salary", 100.5);
+        }
+        valuesBuckets.push_back(std::move(values));
+    }
+
+    int64_t insertNum = 0;
+    int ret = store->BatchInsert(insertNum, "test", valuesBuckets);
+    EXPECT_EQ(ret, E_OK);
+    EXPECT_EQ(100, insertNum);
+
+    int64_t count = 0;
+    ret = store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test WHERE salary IS NOT NULL");
+    EXPECT_EQ(ret, E_OK);
+    EXPECT_EQ(50, count);
+
+    std::unique_ptr<ResultSet> resultSet = store->QuerySql("SELECT name FROM test WHERE age = ?", { "51" });
+    EXPECT_NE(resultSet, nullptr);
+    EXPECT_EQ(resultSet->GoToNextRow(), E_OK);
+    std::string name;
+    EXPECT_EQ(resultSet->GetString(0, name), E_OK);
+    EXPECT_EQ(name, "zhangsan51");
+    EXPECT_EQ(resultSet->Close(), E_OK);
+}
+
+/**
+ * @tc.name: RdbStore_BatchInsert_002
+ * @tc.desc: test RdbStore BatchInsert rolls back all rows when one row fails
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbStoreInsertTest, RdbStore_BatchInsert_002, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbStoreInsertTest::store;
+
+    std::vector<ValuesBucket> valuesBuckets;
+    for (int i = 0; i < 10; i++) {
+        ValuesBucket values;
+        values.PutInt("age", i);
+        if (i != 5) {
+            values.PutString("name", std::string("lisi"));
+        }
+        valuesBuckets.push_back(std::move(values));
+    }
+
+    int64_t insertNum = 0;
+    int ret = store->BatchInsert(insertNum, "test", valuesBuckets);
+    EXPECT_EQ(ret, RdbStoreInsertTest::E_SQLITE_CONSTRAINT);
+    EXPECT_EQ(0, insertNum);
+
+    int64_t count = -1;
+    ret = store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test");
+    EXPECT_EQ(ret, E_OK);
+    EXPECT_EQ(0, count);
+    EXPECT_EQ(store->IsInTransaction(), false);
+
+    ret = store->BatchInsert(insertNum, "", valuesBuckets);
+    EXPECT_EQ(ret, E_EMPTY_TABLE_NAME);
+    valuesBuckets.push_back(ValuesBucket());
+    ret = store->BatchInsert(insertNum, "test", valuesBuckets);
+    EXPECT_EQ(ret, E_EMPTY_VALUES_BUCKET);
+    ret = store->BatchInsert(insertNum, "test", std::vector<ValuesBucket>());
+    EXPECT_EQ(ret, E_OK);
+    EXPECT_EQ(0, insertNum);
+
+    // a column name holding a comma is not grouped with the columns it seems to list
+    valuesBuckets.clear();
+    ValuesBucket values;
+    values.PutString("name", std::string("lisi"));
+    values.PutInt("age", 18);
+    valuesBuckets.push_back(values);
+    ValuesBucket joinedValues;
+    joinedValues.PutString("name,age", std::string("lisi"));
+    valuesBuckets.push_back(joinedValues);
+    ret = store->BatchInsert(insertNum, "test", valuesBuckets);
+    EXPECT_NE(ret, E_OK);
+    EXPECT_EQ(0, insertNum);
+}
+
+/**
+ * @tc.name: RdbStore_Upsert_001
+ * @tc.desc: test RdbStore Upsert and BatchUpsert update the conflicting row in place
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbStoreInsertTest, RdbStore_Upsert_001, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbStoreInsertTest::store;
+
+    ValuesBucket values;
+    values.PutInt("id", 1);
+    values.PutString("name", std::string("zhangsan"));
+    values.PutInt("age", 18);
+    int64_t changedRows = 0;
+    EXPECT_EQ(store->Upsert(changedRows, "test", values, { "id" }, {}), E_OK);
+    EXPECT_EQ(1, changedRows);
+
+    ValuesBucket newValues;
+    newValues.PutInt("id", 1);
+    newValues.PutString("name", std::string("lisi"));
+    newValues.PutInt("age", 20);
+    EXPECT_EQ(store->Upsert(changedRows, "test", newValues, { "id" }, { "age" }), E_OK);
+    EXPECT_EQ(1, changedRows);
+    std::string name;
+    EXPECT_EQ(store->ExecuteAndGetString(name, "SELECT name FROM test WHERE id = 1 AND age = 20"), E_OK);
+    EXPECT_EQ(name, "zhangsan");
+
+    EXPECT_EQ(store->Upsert(changedRows, "test", newValues, { "id" }, {}), E_OK);
+    EXPECT_EQ(store->ExecuteAndGetString(name, "SELECT name FROM test WHERE id = 1"), E_OK);
+    EXPECT_EQ(name, "lisi");
+
+    std::vector<ValuesBucket> valuesBuckets;
+    for (int i = 1; i <= 100; i++) {
+        ValuesBucket row;
+        row.PutInt("id", i);
+        row.PutString("name", std::string("wangwu"));
+        valuesBuckets.push_back(std::move(row));
+    }
+    EXPECT_EQ(store->BatchUpsert(changedRows, "test", valuesBuckets, { "id" }, { "name" }), E_OK);
+    EXPECT_EQ(100, changedRows);
+    int64_t count = 0;
+    EXPECT_EQ(store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test WHERE name = 'wangwu'"), E_OK);
+    EXPECT_EQ(100, count);
+    EXPECT_EQ(store->ExecuteAndGetLong(count, "SELECT age FROM test WHERE id = 1"), E_OK);
+    EXPECT_EQ(20, count);
+
+    EXPECT_EQ(store->Upsert(changedRows, "test", values, {}, {}), E_INVALID_COLUMN_NAME);
+    EXPECT_EQ(store->Upsert(changedRows, "", values, { "id" }, {}), E_EMPTY_TABLE_NAME);
+    EXPECT_EQ(store->Upsert(changedRows, "test", ValuesBucket(), { "id" }, {}), E_EMPTY_VALUES_BUCKET);
+
+    // an update column missing from the values is rejected instead of reading a NULL excluded value
+    EXPECT_EQ(store->Upsert(changedRows, "test", newValues, { "id" }, { "salary" }), E_INVALID_COLUMN_NAME);
+    EXPECT_EQ(store->BatchUpsert(changedRows, "test", valuesBuckets, { "id" }, { "age" }), E_INVALID_COLUMN_NAME);
+    EXPECT_EQ(store->ExecuteAndGetLong(count, "SELECT age FROM test WHERE id = 1"), E_OK);
+    EXPECT_EQ(20, count);
+}
+
+/**
+ * @tc.name: RdbStore_Insert_SqlCache_001
+ * @tc.desc: test the cached insert sql of a column set is not reused for a column name holding its separator
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbStoreInsertTest, RdbStore_Insert_SqlCache_001, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbStoreInsertTest::store;
+
+    int64_t id;
+    ValuesBucket values;
+    values.PutString("name", std::string("zhangsan"));
+    values.PutInt("age", 18);
+    EXPECT_EQ(store->Insert(id, "test", values), E_OK);
+
+    // one value for two columns, rejected rather than bound to the sql cached for "name" and "age"
+    ValuesBucket joinedValues;
+    joinedValues.PutString("name,age", std::string("lisi"));
+    EXPECT_NE(store->Insert(id, "test", joinedValues), E_OK);
+    int64_t count = 0;
+    EXPECT_EQ(store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test"), E_OK);
+    EXPECT_EQ(1, count);
+}
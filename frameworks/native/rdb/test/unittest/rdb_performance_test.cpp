@@ -0,0 +1,607 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common.h"
+#include "logger.h"
+#include "parcel.h"
+#include "rdb_errno.h"
+#include "rdb_helper.h"
+#include "rdb_open_callback.h"
+#include "rdb_predicates.h"
+#include "rdb_store_impl.h"
+#include "shared_block.h"
+
+using namespace testing::ext;
+using namespace OHOS::NativeRdb;
+
+class RdbPerformanceTest : public testing::Test {
+public:
+    static void SetUpTestCase(void);
+    static void TearDownTestCase(void);
+    void SetUp();
+    void TearDown();
+
+    static int64_t RunConcurrently(int threadCount, int loopCount, const std::function<int()> &operation);
+
+    static const std::string DATABASE_NAME;
+    static std::shared_ptr<RdbStore> store;
+};
+
+const std::string RdbPerformanceTest::DATABASE_NAME = RDB_TEST_PATH + "performance_test.db";
+std::shared_ptr<RdbStore> RdbPerformanceTest::store = nullptr;
+
+class PerformanceTestOpenCallback : public RdbOpenCallback {
+public:
+    int OnCreate(RdbStore &rdbStore) override;
+    int OnUpgrade(RdbStore &rdbStore, int oldVersion, int newVersion) override;
+    static const std::string CREATE_TABLE_TEST;
+};
+
+const std::string PerformanceTestOpenCallback::CREATE_TABLE_TEST = std::string("CREATE TABLE IF NOT EXISTS test ")
+                                                                   + std::string("(id INTEGER PRIMARY KEY "
+                                                                                 "AUTOINCREMENT, name TEXT NOT NULL, "
+                                                                                 "age INTEGER, salary REAL, blobType "
+                                                                                 "BLOB)");
+
+int PerformanceTestOpenCallback::OnCreate(RdbStore &store)
+{
+    return store.ExecuteSql(CREATE_TABLE_TEST);
+}
+
+int PerformanceTestOpenCallback::OnUpgrade(RdbStore &store, int oldVersion, int newVersion)
+{
+    return E_OK;
+}
+
+void RdbPerformanceTest::SetUpTestCase(void)
+{
+    int errCode = E_OK;
+    RdbStoreConfig config(RdbPerformanceTest::DATABASE_NAME);
+    config.SetReadConnectionRange(1, 8);
+    PerformanceTestOpenCallback helper;
+    RdbPerformanceTest::store = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    EXPECT_NE(RdbPerformanceTest::store, nullptr);
+    EXPECT_EQ(errCode, E_OK);
+}
+
+void RdbPerformanceTest::TearDownTestCase(void)
+{
+    RdbPerformanceTest::store = nullptr;
+    RdbHelper::DeleteRdbStore(RdbPerformanceTest::DATABASE_NAME);
+}
+
+void RdbPerformanceTest::SetUp(void)
+{
+    store->ExecuteSql("DELETE FROM test");
+}
+
+void RdbPerformanceTest::TearDown(void)
+{
+}
+
+/**
+ * Runs the operation loopCount times on each of threadCount threads, returns the elapsed microseconds
+ * or -1 if any operation failed.
+ */
+int64_t RdbPerformanceTest::RunConcurrently(int threadCount, int loopCount, const std::function<int()> &operation)
+{
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> threads;
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < threadCount; i++) {
+        threads.emplace_back([&failed, loopCount, &operation]() {
+            for (int j = 0; j < loopCount; j++) {
+                if (operation() != E_OK) {
+                    failed = true;
+                    return;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    if (failed) {
+        return -1;
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+}
+
+/**
+ * @tc.name: RdbStore_Performance_001
+ * @tc.desc: measure the read throughput of one store shared by an increasing number of threads
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbPerformanceTest, RdbStore_Performance_001, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbPerformanceTest::store;
+    int64_t id;
+    ValuesBucket values;
+    for (int i = 1; i <= 100; i++) {
+        values.Clear();
+        values.PutString("name", std::string("zhangsan"));
+        values.PutInt("age", i);
+        EXPECT_EQ(store->Insert(id, "test", values), E_OK);
+    }
+
+    auto operation = [&store]() {
+        int64_t count = 0;
+        int errCode = store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test WHERE age > 50");
+        return (errCode == E_OK && count == 50) ? E_OK : E_ERROR;
+    };
+    const int totalLoopCount = 8000;
+    for (int threadCount : { 1, 2, 4, 8 }) {
+        int64_t elapsed = RunConcurrently(threadCount, totalLoopCount / threadCount, operation);
+        EXPECT_GT(elapsed, 0);
+        LOG_INFO("RdbStore_Performance_001 threads:%{public}d reads:%{public}d elapsed:%{public}lld us",
+            threadCount, totalLoopCount, static_cast<long long>(elapsed));
+        // the sessions of the finished threads are kept for reuse up to a cap for the whole store
+        int idleSessions = std::static_pointer_cast<RdbStoreImpl>(store)->GetIdleSessionCount();
+        EXPECT_GT(idleSessions, 0);
+        EXPECT_LE(idleSessions, 5);
+    }
+}
+
+/**
+ * @tc.name: RdbStore_Performance_002
+ * @tc.desc: compare small concurrent inserts with and without the group commit
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbPerformanceTest, RdbStore_Performance_002, TestSize.Level1)
+{
+    const std::string dbPath = RDB_TEST_PATH + "performance_group_commit_test.db";
+    RdbStoreConfig config(dbPath);
+    config.SetGroupCommitWindow(2);
+    PerformanceTestOpenCallback helper;
+    int errCode = E_OK;
+    std::shared_ptr<RdbStore> groupStore = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    ASSERT_NE(groupStore, nullptr);
+
+    const int threadCount = 8;
+    const int loopCount = 100;
+    for (auto &target : { RdbPerformanceTest::store, groupStore }) {
+        auto operation = [&target]() {
+            int64_t id;
+            ValuesBucket values;
+            values.PutString("name", std::string("zhangsan"));
+            values.PutInt("age", 18);
+            return target->Insert(id, "test", values);
+        };
+        int64_t elapsed = RunConcurrently(threadCount, loopCount, operation);
+        EXPECT_GT(elapsed, 0);
+        LOG_INFO("RdbStore_Performance_002 group commit:%{public}d inserts:%{public}d elapsed:%{public}lld us",
+            target == groupStore, threadCount * loopCount, static_cast<long long>(elapsed));
+    }
+
+    groupStore = nullptr;
+    RdbHelper::DeleteRdbStore(dbPath);
+}
+
+/**
+ * @tc.name: RdbStore_Performance_003
+ * @tc.desc: compare point and range query latency of read connections with and without memory mapping
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbPerformanceTest, RdbStore_Performance_003, TestSize.Level1)
+{
+    const int rowCount = 20000;
+    const int queryCount = 2000;
+    const int rangeSize = 100;
+    for (bool mmapEnabled : { false, true }) {
+        const std::string dbPath = RDB_TEST_PATH + "performance_mmap_test.db";
+        RdbStoreConfig config(dbPath);
+        config.SetReadConnectionMmap(mmapEnabled);
+        PerformanceTestOpenCallback helper;
+        int errCode = E_OK;
+        std::shared_ptr<RdbStore> mmapStore = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+        ASSERT_NE(mmapStore, nullptr);
+
+        std::vector<ValuesBucket> rows;
+        for (int i = 0; i < rowCount; i++) {
+            ValuesBucket values;
+            values.PutString("name", std::string(200, 'a' + i % 26));
+            values.PutInt("age", i);
+            rows.push_back(std::move(values));
+        }
+        int64_t insertNum = 0;
+        EXPECT_EQ(mmapStore->BatchInsert(insertNum, "test", rows), E_OK);
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < queryCount; i++) {
+            int64_t age = 0;
+            std::vector<ValueObject> args = { ValueObject(static_cast<int64_t>((i * 7919) % rowCount + 1)) };
+            EXPECT_EQ(mmapStore->ExecuteAndGetLong(age, "SELECT age FROM test WHERE id = ?", args), E_OK);
+        }
+        auto pointElapsed = std::chrono::steady_clock::now() - begin;
+        begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < queryCount; i++) {
+            int64_t length = 0;
+            int64_t first = (i * 7919) % (rowCount - rangeSize) + 1;
+            std::vector<ValueObject> args = { ValueObject(first), ValueObject(first + rangeSize) };
+            EXPECT_EQ(mmapStore->ExecuteAndGetLong(length,
+                "SELECT SUM(LENGTH(name)) FROM test WHERE id >= ? AND id < ?", args), E_OK);
+        }
+        auto rangeElapsed = std::chrono::steady_clock::now() - begin;
+        LOG_INFO("RdbStore_Performance_003 mmap:%{public}d point query:%{public}lld us range query:%{public}lld us",
+            mmapEnabled,
+            static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(pointElapsed).count()),
+            static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(rangeElapsed).count()));
+
+        mmapStore = nullptr;
+        RdbHelper::DeleteRdbStore(dbPath);
+    }
+}
+
+/**
+ * @tc.name: RdbStore_Performance_004
+ * @tc.desc: measure the insert throughput of large blob and text arguments
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbPerformanceTest, RdbStore_Performance_004, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbPerformanceTest::store;
+    const int insertCount = 200;
+    const size_t blobSize = 1024 * 1024;
+    std::vector<ValueObject> args = { ValueObject(std::string(blobSize, 'a')),
+        ValueObject(std::vector<uint8_t>(blobSize, 1)) };
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < insertCount; i++) {
+        EXPECT_EQ(store->ExecuteSql("INSERT INTO test (name, blobType) VALUES (?, ?)", args), E_OK);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+
+    int64_t count = 0;
+    EXPECT_EQ(store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test WHERE LENGTH(blobType) = 1048576"), E_OK);
+    EXPECT_EQ(count, insertCount);
+    LOG_INFO("RdbStore_Performance_004 inserts:%{public}d bytes:%{public}zu elapsed:%{public}lld us",
+        insertCount, 2 * blobSize * insertCount, static_cast<long long>(elapsed));
+}
+
+/**
+ * @tc.name: RdbStore_Performance_005
+ * @tc.desc: compare the indexed lookup latency of text and typed where arguments
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbPerformanceTest, RdbStore_Performance_005, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbPerformanceTest::store;
+    const int rowCount = 1000;
+    std::vector<ValuesBucket> rows;
+    for (int i = 0; i < rowCount; i++) {
+        ValuesBucket values;
+        values.PutString("name", std::string("zhangsan"));
+        values.PutInt("age", i);
+        rows.push_back(values);
+    }
+    int64_t insertNum = 0;
+    EXPECT_EQ(store->BatchInsert(insertNum, "test", rows), E_OK);
+    EXPECT_EQ(store->ExecuteSql("CREATE INDEX IF NOT EXISTS test_age_index ON test(age)"), E_OK);
+
+    for (bool isTyped : { false, true }) {
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < rowCount; i++) {
+            RdbPredicates predicates("test");
+            if (isTyped) {
+                predicates.GreaterThanOrEqualTo("age", ValueObject(i));
+                predicates.LessThan("age", ValueObject(i + 1));
+            } else {
+                predicates.GreaterThanOrEqualTo("age", std::to_string(i));
+                predicates.LessThan("age", std::to_string(i + 1));
+            }
+            int64_t count = 0;
+            EXPECT_EQ(store->Count(count, predicates), E_OK);
+            EXPECT_EQ(count, 1);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count();
+        LOG_INFO("RdbStore_Performance_005 typed:%{public}d lookups:%{public}d elapsed:%{public}lld us",
+            isTyped, rowCount, static_cast<long long>(elapsed));
+    }
+    EXPECT_EQ(store->ExecuteSql("DROP INDEX test_age_index"), E_OK);
+}
+
+/**
+ * @tc.name: RdbStore_Performance_006
+ * @tc.desc: build predicates with many terms and a large IN list and check the rendered clause
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbPerformanceTest, RdbStore_Performance_006, TestSize.Level1)
+{
+    const int termCount = 10000;
+    auto begin = std::chrono::steady_clock::now();
+    RdbPredicates predicates("test");
+    for (int i = 0; i < termCount; i++) {
+        predicates.EqualTo("age", ValueObject(i))->Or();
+    }
+    std::vector<ValueObject> values;
+    for (int i = 0; i < termCount; i++) {
+        values.emplace_back(i);
+    }
+    predicates.In("id", values);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+
+    EXPECT_EQ(predicates.GetBindArgs().size(), static_cast<size_t>(2 * termCount));
+    const std::string &whereClause = predicates.GetWhereClause();
+    EXPECT_EQ(whereClause.compare(0, 8, "age = ? "), 0);
+    EXPECT_NE(whereClause.find("id IN (? , ? , ?"), std::string::npos);
+    EXPECT_EQ(whereClause.back(), ')');
+    LOG_INFO("RdbStore_Performance_006 terms:%{public}d clause:%{public}zu elapsed:%{public}lld us",
+        2 * termCount, whereClause.size(), static_cast<long long>(elapsed));
+}
+
+/**
+ * @tc.name: RdbStore_Performance_007
+ * @tc.desc: fetch a large id set bound as one array parameter
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbPerformanceTest, RdbStore_Performance_007, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbPerformanceTest::store;
+    const int rowCount = 20000;
+    std::vector<ValuesBucket> rows;
+    for (int i = 0; i < rowCount; i++) {
+        ValuesBucket values;
+        values.PutInt("id", i + 1);
+        values.PutString("name", std::string("zhangsan"));
+        rows.push_back(values);
+    }
+    int64_t insertNum = 0;
+    EXPECT_EQ(store->BatchInsert(insertNum, "test", rows), E_OK);
+
+    std::vector<ValueObject> ids;
+    for (int i = 0; i < rowCount; i++) {
+        ids.emplace_back(i + 1);
+    }
+    auto begin = std::chrono::steady_clock::now();
+    RdbPredicates predicates("test");
+    predicates.InLargeSet("id", ids);
+    int64_t count = 0;
+    EXPECT_EQ(store->Count(count, predicates), E_OK);
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    EXPECT_EQ(count, rowCount);
+    LOG_INFO("RdbStore_Performance_007 ids:%{public}d elapsed:%{public}lld us", rowCount,
+        static_cast<long long>(elapsed));
+}
+
+/**
+ * @tc.name: RdbStore_Performance_008
+ * @tc.desc: compare repeated executions of sql text and of a prepared statement
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbPerformanceTest, RdbStore_Performance_008, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbPerformanceTest::store;
+    const int loopCount = 10000;
+    const std::string sql = "INSERT INTO test (name, age) VALUES (?, ?)";
+    int errCode = E_OK;
+    std::shared_ptr<RdbStatement> statement = store->Prepare(errCode, sql);
+    ASSERT_NE(statement, nullptr);
+
+    for (bool isPrepared : { false, true }) {
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < loopCount; i++) {
+            int64_t id = 0;
+            std::vector<ValueObject> args = { ValueObject(std::string("zhangsan")), ValueObject(i) };
+            if (isPrepared) {
+                EXPECT_EQ(statement->BindArgs(args), E_OK);
+                EXPECT_EQ(statement->ExecuteForLastInsertedRowId(id), E_OK);
+            } else {
+                EXPECT_EQ(store->ExecuteForLastInsertedRowId(id, sql, args), E_OK);
+            }
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - begin).count();
+        LOG_INFO("RdbStore_Performance_008 prepared:%{public}d inserts:%{public}d elapsed:%{public}lld us",
+            isPrepared, loopCount, static_cast<long long>(elapsed));
+    }
+    int64_t count = 0;
+    EXPECT_EQ(store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test"), E_OK);
+    EXPECT_EQ(count, 2 * loopCount);
+}
+
+/**
+ * @tc.name: RdbStore_Performance_009
+ * @tc.desc: measure the latency of single row inserts and updates built from value buckets
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbPerformanceTest, RdbStore_Performance_009, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbPerformanceTest::store;
+    const int loopCount = 10000;
+    std::vector<int64_t> ids(loopCount);
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < loopCount; i++) {
+        ValuesBucket values;
+        values.PutString("name", std::string("zhangsan"));
+        values.PutInt("age", i);
+        values.PutDouble("salary", 100.5);
+        EXPECT_EQ(store->Insert(ids[i], "test", values), E_OK);
+    }
+    auto insertElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+
+    begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < loopCount; i++) {
+        ValuesBucket values;
+        values.PutDouble("salary", 200.5);
+        int changedRows = 0;
+        EXPECT_EQ(store->Update(changedRows, "test", values, "id = ?", std::vector<ValueObject>{ ValueObject(ids[i]) }),
+            E_OK);
+        EXPECT_EQ(changedRows, 1);
+    }
+    auto updateElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    LOG_INFO("RdbStore_Performance_009 rows:%{public}d insert:%{public}lld us update:%{public}lld us", loopCount,
+        static_cast<long long>(insertElapsed), static_cast<long long>(updateElapsed));
+}
+
+/**
+ * @tc.name: RdbStore_Performance_010
+ * @tc.desc: measure building, parceling and inserting value buckets of 20 columns against a map of the same values
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbPerformanceTest, RdbStore_Performance_010, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbPerformanceTest::store;
+    const int rowCount = 1000;
+    const int columnCount = 20;
+    std::vector<std::string> names;
+    for (int i = 0; i < columnCount; i++) {
+        names.push_back("column" + std::to_string(i));
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < rowCount; i++) {
+        std::map<std::string, ValueObject> valuesMap;
+        for (int j = 0; j < columnCount; j++) {
+            valuesMap.insert(std::make_pair(names[j], ValueObject(i + j)));
+        }
+        EXPECT_EQ(valuesMap.size(), static_cast<size_t>(columnCount));
+    }
+    auto mapElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+
+    std::vector<ValuesBucket> rows(rowCount);
+    begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < rowCount; i++) {
+        for (int j = 0; j < columnCount; j++) {
+            rows[i].PutInt(names[j], i + j);
+        }
+    }
+    auto buildElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+
+    begin = std::chrono::steady_clock::now();
+    for (auto &row : rows) {
+        OHOS::Parcel parcel;
+        EXPECT_TRUE(row.Marshalling(parcel));
+        std::unique_ptr<ValuesBucket> copy(ValuesBucket::Unmarshalling(parcel));
+        EXPECT_EQ(copy->Size(), columnCount);
+    }
+    auto parcelElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+
+    std::string columns;
+    for (auto &name : names) {
+        columns.append(", ").append(name).append(" INTEGER");
+    }
+    EXPECT_EQ(store->ExecuteSql("CREATE TABLE IF NOT EXISTS wide (id INTEGER PRIMARY KEY" + columns + ")"), E_OK);
+    begin = std::chrono::steady_clock::now();
+    for (auto &row : rows) {
+        int64_t id = 0;
+        EXPECT_EQ(store->Insert(id, "wide", row), E_OK);
+    }
+    auto insertElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    EXPECT_EQ(store->ExecuteSql("DROP TABLE wide"), E_OK);
+    LOG_INFO("RdbStore_Performance_010 rows:%{public}d map:%{public}lld us build:%{public}lld us "
+        "parcel:%{public}lld us insert:%{public}lld us", rowCount, static_cast<long long>(mapElapsed),
+        static_cast<long long>(buildElapsed), static_cast<long long>(parcelElapsed),
+        static_cast<long long>(insertElapsed));
+}
+
+/**
+ * @tc.name: RdbStore_Performance_011
+ * @tc.desc: fill a SharedBlock of 20000 rows, then read its cells sequentially and at random rows
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbPerformanceTest, RdbStore_Performance_011, TestSize.Level1)
+{
+    using OHOS::AppDataFwk::SharedBlock;
+    const uint32_t rowCount = 20000;
+    const uint32_t columnCount = 4;
+    const size_t blockSize = 4 * 1024 * 1024;
+    SharedBlock *block = nullptr;
+    ASSERT_EQ(SharedBlock::Create("performance_011", blockSize, block), SharedBlock::SHARED_BLOCK_OK);
+    std::unique_ptr<SharedBlock> holder(block);
+    EXPECT_EQ(block->Clear(), SharedBlock::SHARED_BLOCK_OK);
+    EXPECT_EQ(block->SetColumnNum(columnCount), SharedBlock::SHARED_BLOCK_OK);
+
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t row = 0; row < rowCount; row++) {
+        ASSERT_EQ(block->AllocRow(), SharedBlock::SHARED_BLOCK_OK);
+        std::string name = "name" + std::to_string(row);
+        EXPECT_EQ(block->PutLong(row, 0, row), SharedBlock::SHARED_BLOCK_OK);
+        EXPECT_EQ(block->PutDouble(row, 1, row * 0.5), SharedBlock::SHARED_BLOCK_OK);
+        EXPECT_EQ(block->PutString(row, 2, name.c_str(), name.size() + 1), SharedBlock::SHARED_BLOCK_OK);
+        EXPECT_EQ(block->PutNull(row, 3), SharedBlock::SHARED_BLOCK_OK);
+    }
+    auto fillElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+
+    begin = std::chrono::steady_clock::now();
+    for (uint32_t row = 0; row < rowCount; row++) {
+        for (uint32_t column = 0; column < columnCount; column++) {
+            ASSERT_NE(block->GetCellUnit(row, column), nullptr);
+        }
+        EXPECT_EQ(block->GetCellUnit(row, 0)->cell.longValue, row);
+    }
+    auto sequentialElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+
+    std::mt19937 random(rowCount);
+    std::vector<uint32_t> rows(rowCount);
+    for (auto &row : rows) {
+        row = random() % rowCount;
+    }
+    begin = std::chrono::steady_clock::now();
+    for (auto row : rows) {
+        for (uint32_t column = 0; column < columnCount; column++) {
+            ASSERT_NE(block->GetCellUnit(row, column), nullptr);
+        }
+        EXPECT_EQ(block->GetCellUnit(row, 0)->cell.longValue, row);
+    }
+    auto randomElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    EXPECT_EQ(block->GetCellUnit(rowCount, 0), nullptr);
+    LOG_INFO("RdbStore_Performance_011 rows:%{public}u fill:%{public}lld us sequential:%{public}lld us "
+        "random:%{public}lld us", rowCount, static_cast<long long>(fillElapsed),
+        static_cast<long long>(sequentialElapsed), static_cast<long long>(randomElapsed));
+}
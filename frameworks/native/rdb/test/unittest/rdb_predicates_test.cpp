@@ -22,12 +22,14 @@
 #include <sstream>
 #include <algorithm>
 #include <ctime>
+#include <limits>
 
 #include "common.h"
 #include "rdb_errno.h"
 #include "rdb_helper.h"
 #include "rdb_open_callback.h"
 #include "rdb_predicates.h"
+#include "sqlite_global_config.h"
 
 using namespace testing::ext;
 using namespace OHOS::NativeRdb;
@@ -1561,3 +1563,103 @@ HWTEST_F(RdbStorePredicateTest, RdbStore_KeywordMethod_024, TestSize.Level1)
     EXPECT_EQ(true, predicates1.GetOrder().empty());
     EXPECT_EQ(false, predicates1.IsDistinct());
 }
+
+/* *
+ * @tc.name: RdbStore_TypedArgsMethod_025
+ * @tc.desc: Normal testCase of RdbPredicates with typed where arguments
+ * @tc.type: FUNC
+ * @tc.require: AR000FKD4F
+ */
+HWTEST_F(RdbStorePredicateTest, RdbStore_TypedArgsMethod_025, TestSize.Level1)
+{
+    std::vector<std::string> columns;
+    RdbPredicates predicates1("AllDataType");
+    predicates1.EqualTo("integerValue", ValueObject(INT_MAX));
+    std::unique_ptr<ResultSet> resultSet1 = RdbStorePredicateTest::store->Query(predicates1, columns);
+    int count = 0;
+    resultSet1->GetRowCount(count);
+    EXPECT_EQ(1, count);
+    std::vector<ValueObject> bindArgs = predicates1.GetBindArgs();
+    ASSERT_EQ((size_t)1, bindArgs.size());
+    EXPECT_EQ(ValueObjectType::TYPE_INT, bindArgs[0].GetType());
+    EXPECT_EQ(std::to_string(INT_MAX), predicates1.GetWhereArgs()[0]);
+
+    RdbPredicates predicates2("AllDataType");
+    predicates2.Between("doubleValue", ValueObject(0.5), ValueObject(1.5))
+        ->In("longValue", std::vector<ValueObject>{ ValueObject(int64_t(1)), ValueObject(int64_t(2)) });
+    int64_t rowCount = 0;
+    EXPECT_EQ(E_OK, RdbStorePredicateTest::store->Count(rowCount, predicates2));
+    EXPECT_EQ(1, rowCount);
+
+    // the text form of a real reads back unchanged
+    RdbPredicates predicates3("AllDataType");
+    predicates3.EqualTo("doubleValue", ValueObject(0.1))->GreaterThan("doubleValue", ValueObject(1.0 / 3));
+    std::vector<std::string> whereArgs = predicates3.GetWhereArgs();
+    ASSERT_EQ((size_t)2, whereArgs.size());
+    EXPECT_EQ(0.1, std::stod(whereArgs[0]));
+    EXPECT_EQ(1.0 / 3, std::stod(whereArgs[1]));
+
+    int changedRows = 0;
+    ValuesBucket values;
+    values.PutString("stringValue", std::string("typed"));
+    EXPECT_EQ(E_OK, RdbStorePredicateTest::store->Update(changedRows, "AllDataType", values, "integerValue = ?",
+        std::vector<ValueObject>{ ValueObject(INT_MAX) }));
+    EXPECT_EQ(1, changedRows);
+
+    std::vector<ValueObject> selectionArgs = { ValueObject(std::string("typed")) };
+    std::unique_ptr<ResultSet> resultSet2 = RdbStorePredicateTest::store->QuerySql(
+        "SELECT * FROM AllDataType WHERE stringValue = ?", selectionArgs);
+    resultSet2->GetRowCount(count);
+    EXPECT_EQ(1, count);
+
+    values.PutString("stringValue", std::string("ABCDEFGHIJKLMN"));
+    EXPECT_EQ(E_OK, RdbStorePredicateTest::store->Update(changedRows, "AllDataType", values, "integerValue = ?",
+        std::vector<ValueObject>{ ValueObject(INT_MAX) }));
+}
+
+/**
+ * @tc.name: RdbStore_LargeSetMethod_026
+ * @tc.desc: Normal testCase of RdbPredicates for InLargeSet and NotInLargeSet
+ * @tc.type: FUNC
+ * @tc.require: AR000FKD4F
+ */
+HWTEST_F(RdbStorePredicateTest, RdbStore_LargeSetMethod_026, TestSize.Level1)
+{
+    std::vector<ValueObject> names;
+    for (size_t i = 0; i <= AbsPredicates::LARGE_SET_THRESHOLD; i++) {
+        names.emplace_back("name\"\\\n" + std::to_string(i));
+    }
+    names.emplace_back(std::string("ABCDEFGHIJKLMN"));
+    // json_each() used by the large sets is part of the SQLite the store links
+    ASSERT_TRUE(SqliteGlobalConfig::IsJsonSupported());
+    int64_t count = 0;
+    EXPECT_EQ(E_OK, RdbStorePredicateTest::store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM json_each('[1,2]')"));
+    EXPECT_EQ(2, count);
+
+    RdbPredicates predicates1("AllDataType");
+    predicates1.InLargeSet("stringValue", names);
+    EXPECT_EQ((size_t)1, predicates1.GetBindArgs().size());
+    EXPECT_EQ("stringValue IN (SELECT value FROM json_each(?))", predicates1.GetWhereClause());
+    EXPECT_EQ(E_OK, RdbStorePredicateTest::store->Count(count, predicates1));
+    EXPECT_EQ(1, count);
+
+    std::vector<ValueObject> ids;
+    for (int i = 0; i <= static_cast<int>(AbsPredicates::LARGE_SET_THRESHOLD); i++) {
+        ids.emplace_back(i + 2);
+    }
+    RdbPredicates predicates2("AllDataType");
+    predicates2.NotInLargeSet("id", ids);
+    EXPECT_EQ(E_OK, RdbStorePredicateTest::store->Count(count, predicates2));
+    EXPECT_EQ(1, count);
+
+    std::vector<ValueObject> blobs(AbsPredicates::LARGE_SET_THRESHOLD + 1, ValueObject(std::vector<uint8_t>{ 1 }));
+    RdbPredicates predicates3("AllDataType");
+    predicates3.InLargeSet("blobValue", blobs);
+    EXPECT_EQ(blobs.size(), predicates3.GetBindArgs().size());
+
+    std::vector<ValueObject> reals(AbsPredicates::LARGE_SET_THRESHOLD, ValueObject(0.5));
+    reals.emplace_back(std::numeric_limits<double>::infinity());
+    RdbPredicates predicates4("AllDataType");
+    predicates4.InLargeSet("doubleValue", reals);
+    EXPECT_EQ(reals.size(), predicates4.GetBindArgs().size());
+}
@@ -907,3 +907,291 @@ HWTEST_F(RdbSqliteSharedResultSetTest, Sqlite_Shared_Result_Set_017, TestSize.Le
     int ret = rstSet->GoToLastRow();
     EXPECT_EQ(ret, E_OK);
 }
+
+/* *
+ * @tc.name: Sqlite_Shared_Result_Set_018
+ * @tc.desc: normal testcase of SqliteSharedResultSet for getColumnIndexes, names match without case and table prefix
+ * @tc.type: FUNC
+ * @tc.require: AR000FKD4F
+ */
+HWTEST_F(RdbSqliteSharedResultSetTest, Sqlite_Shared_Result_Set_018, TestSize.Level1)
+{
+    GenerateDefaultTable();
+    std::vector<std::string> selectionArgs;
+    std::unique_ptr<ResultSet> rstSet =
+        RdbSqliteSharedResultSetTest::store->QuerySql("SELECT * FROM test", selectionArgs);
+    EXPECT_NE(rstSet, nullptr);
+
+    std::vector<int> colIndexes;
+    int ret = rstSet->GetColumnIndexes({ "DATA4", "test.data1", "Data2" }, colIndexes);
+    EXPECT_EQ(ret, E_OK);
+    EXPECT_EQ(colIndexes, std::vector<int>({ 4, 1, 2 }));
+
+    std::vector<int> missingIndexes;
+    ret = rstSet->GetColumnIndexes({ "data3", "datax" }, missingIndexes);
+    EXPECT_EQ(ret, E_ERROR);
+    EXPECT_EQ(missingIndexes, std::vector<int>({ 3, -1 }));
+
+    int colIndex = 0;
+    EXPECT_EQ(rstSet->GetColumnIndex("ID", colIndex), E_OK);
+    EXPECT_EQ(colIndex, 0);
+    std::string colName;
+    EXPECT_EQ(rstSet->GetColumnName(3, colName), E_OK);
+    EXPECT_EQ(colName, "data3");
+    EXPECT_EQ(rstSet->GetColumnName(5, colName), E_INVALID_COLUMN_INDEX);
+    int colCount = 0;
+    EXPECT_EQ(rstSet->GetColumnCount(colCount), E_OK);
+    EXPECT_EQ(colCount, 5);
+
+    EXPECT_EQ(rstSet->GoToFirstRow(), E_OK);
+    std::string data1;
+    EXPECT_EQ(rstSet->GetString(colIndexes[1], data1), E_OK);
+    EXPECT_EQ(data1, "hello");
+    rstSet->Close();
+}
+
+/* *
+ * @tc.name: Sqlite_Shared_Result_Set_019
+ * @tc.desc: normal testcase of SqliteSharedResultSet for columnar columns read as arrays
+ * @tc.type: FUNC
+ * @tc.require: AR000FKD4F
+ */
+HWTEST_F(RdbSqliteSharedResultSetTest, Sqlite_Shared_Result_Set_019, TestSize.Level1)
+{
+    GenerateDefaultTable();
+    std::vector<std::string> selectionArgs;
+    std::unique_ptr<AbsSharedResultSet> rstSet =
+        RdbSqliteSharedResultSetTest::store->QuerySql("SELECT * FROM test ORDER BY id", selectionArgs);
+    EXPECT_NE(rstSet, nullptr);
+    EXPECT_EQ(rstSet->SetColumnarColumns({ 2, 3, 1 }), E_OK);
+
+    OHOS::AppDataFwk::SharedBlock::ColumnView view;
+    EXPECT_EQ(rstSet->GetColumnView(2, view), E_OK);
+    EXPECT_EQ(view.rowNum, 3u);
+    int64_t sum = 0;
+    for (uint32_t i = 0; i < view.rowNum; i++) {
+        EXPECT_EQ(view.types[i], OHOS::AppDataFwk::SharedBlock::CELL_UNIT_TYPE_INTEGER);
+        sum += view.longs[i];
+    }
+    EXPECT_EQ(sum, 8);
+
+    EXPECT_EQ(rstSet->GetColumnView(3, view), E_OK);
+    EXPECT_EQ(view.types[1], OHOS::AppDataFwk::SharedBlock::CELL_UNIT_TYPE_FLOAT);
+    EXPECT_EQ(view.doubles[1], 2.5);
+    EXPECT_EQ(rstSet->GetColumnView(1, view), E_OK);
+    EXPECT_EQ(view.types[0], OHOS::AppDataFwk::SharedBlock::CELL_UNIT_TYPE_STRING);
+
+    EXPECT_EQ(rstSet->GetColumnView(4, view), E_ERROR);
+    EXPECT_EQ(rstSet->GetColumnView(5, view), E_INVALID_COLUMN_INDEX);
+    // the filled window can not get the arrays of more columns
+    EXPECT_EQ(rstSet->SetColumnarColumns({ 4 }), E_NOT_SUPPORT);
+
+    // the cells stay readable row by row
+    EXPECT_EQ(rstSet->GoToRow(2), E_OK);
+    int data2 = 0;
+    EXPECT_EQ(rstSet->GetInt(2, data2), E_OK);
+    EXPECT_EQ(data2, 3);
+    rstSet->Close();
+}
+
+/* *
+ * @tc.name: Sqlite_Shared_Result_Set_020
+ * @tc.desc: normal testcase of SqliteSharedResultSet for blocks reused from the pool after close
+ * @tc.type: FUNC
+ * @tc.require: AR000FKD4F
+ */
+HWTEST_F(RdbSqliteSharedResultSetTest, Sqlite_Shared_Result_Set_020, TestSize.Level1)
+{
+    using OHOS::AppDataFwk::SharedBlock;
+    GenerateDefaultTable();
+    std::vector<std::string> selectionArgs;
+    std::unique_ptr<AbsSharedResultSet> rstSet =
+        RdbSqliteSharedResultSetTest::store->QuerySql("SELECT * FROM test ORDER BY id", selectionArgs);
+    EXPECT_NE(rstSet, nullptr);
+    EXPECT_EQ(rstSet->GoToLastRow(), E_OK);
+    EXPECT_EQ(rstSet->Close(), E_OK);
+
+    SharedBlock::PoolStats before = SharedBlock::GetPoolStats();
+    EXPECT_GT(before.idleBytes, 0u);
+    rstSet = RdbSqliteSharedResultSetTest::store->QuerySql("SELECT data2 FROM test ORDER BY id", selectionArgs);
+    EXPECT_NE(rstSet, nullptr);
+    SharedBlock::PoolStats after = SharedBlock::GetPoolStats();
+    EXPECT_EQ(after.createCount, before.createCount);
+    EXPECT_EQ(after.reuseCount, before.reuseCount + 1);
+
+    int rowCnt = 0;
+    EXPECT_EQ(rstSet->GetRowCount(rowCnt), E_OK);
+    EXPECT_EQ(rowCnt, 3);
+    EXPECT_EQ(rstSet->GoToFirstRow(), E_OK);
+    int data2 = 0;
+    EXPECT_EQ(rstSet->GetInt(0, data2), E_OK);
+    EXPECT_EQ(data2, 10);
+
+    // a block whose fd was handed out may still be mapped, so it is not reused
+    EXPECT_GE(rstSet->GetBlock()->GetFd(), 0);
+    EXPECT_TRUE(rstSet->GetBlock()->IsShared());
+    before = SharedBlock::GetPoolStats();
+    rstSet->Close();
+    after = SharedBlock::GetPoolStats();
+    EXPECT_EQ(after.idleBytes, before.idleBytes);
+}
+
+/* *
+ * @tc.name: Sqlite_Shared_Result_Set_021
+ * @tc.desc: normal testcase of SqliteSharedResultSet for blocks sized from the row width between windows
+ * @tc.type: FUNC
+ * @tc.require: AR000FKD4F
+ */
+HWTEST_F(RdbSqliteSharedResultSetTest, Sqlite_Shared_Result_Set_021, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbSqliteSharedResultSetTest::store;
+    const int rowCount = 600;
+    const std::string text(1000, 'a');
+    int64_t id;
+    ValuesBucket values;
+    for (int i = 1; i <= rowCount; i++) {
+        values.Clear();
+        values.PutInt("id", i);
+        values.PutString("data1", text);
+        EXPECT_EQ(store->Insert(id, "test", values), E_OK);
+    }
+
+    std::vector<std::string> selectionArgs;
+    std::unique_ptr<AbsSharedResultSet> rstSet =
+        store->QuerySql("SELECT id, data1 FROM test ORDER BY id", selectionArgs);
+    EXPECT_NE(rstSet, nullptr);
+    EXPECT_EQ(rstSet->SetBlockSizeLimits(0, 1024), E_ERROR);
+
+    // the rows past the first window are read from the next block at their own position
+    int rows = 0;
+    while (rstSet->GoToNextRow() == E_OK) {
+        int rowId = 0;
+        EXPECT_EQ(rstSet->GetInt(0, rowId), E_OK);
+        EXPECT_EQ(rowId, rows + 1);
+        rows++;
+    }
+    EXPECT_EQ(rows, rowCount);
+
+    AbsSharedResultSet::BlockStats stats;
+    EXPECT_EQ(rstSet->GetBlockStats(stats), E_OK);
+    EXPECT_GT(stats.rowWidth, text.size());
+    EXPECT_EQ(stats.fillCount, 2u);
+    EXPECT_GT(stats.lastBlockSize, stats.firstBlockSize);
+    EXPECT_EQ(stats.maxBlockSize, stats.lastBlockSize);
+    rstSet->Close();
+}
+
+/* *
+ * @tc.name: Sqlite_Shared_Result_Set_022
+ * @tc.desc: normal testcase of SqliteSharedResultSet for the next window prefetched on a worker thread
+ * @tc.type: FUNC
+ * @tc.require: AR000FKD4F
+ */
+HWTEST_F(RdbSqliteSharedResultSetTest, Sqlite_Shared_Result_Set_022, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbSqliteSharedResultSetTest::store;
+    const int rowCount = 600;
+    const std::string text(1000, 'b');
+    int64_t id;
+    ValuesBucket values;
+    for (int i = 1; i <= rowCount; i++) {
+        values.Clear();
+        values.PutInt("id", i);
+        values.PutString("data1", text);
+        EXPECT_EQ(store->Insert(id, "test", values), E_OK);
+    }
+
+    std::vector<std::string> selectionArgs;
+    std::unique_ptr<AbsSharedResultSet> rstSet =
+        store->QuerySql("SELECT id, data1 FROM test ORDER BY id", selectionArgs);
+    EXPECT_NE(rstSet, nullptr);
+    EXPECT_EQ(rstSet->SetPrefetchNextBlock(true), E_OK);
+
+    int rows = 0;
+    while (rstSet->GoToNextRow() == E_OK) {
+        int rowId = 0;
+        EXPECT_EQ(rstSet->GetInt(0, rowId), E_OK);
+        EXPECT_EQ(rowId, rows + 1);
+        std::string data1;
+        EXPECT_EQ(rstSet->GetString(1, data1), E_OK);
+        EXPECT_EQ(data1, text);
+        rows++;
+    }
+    EXPECT_EQ(rows, rowCount);
+    // the first window is filled on this thread, the later ones are swapped in from the worker
+    AbsSharedResultSet::BlockStats stats;
+    EXPECT_EQ(rstSet->GetBlockStats(stats), E_OK);
+    EXPECT_GT(stats.fillCount, 1u);
+
+    // a move back out of the prefetched windows fills the block again on this thread
+    EXPECT_EQ(rstSet->GoToFirstRow(), E_OK);
+    int rowId = 0;
+    EXPECT_EQ(rstSet->GetInt(0, rowId), E_OK);
+    EXPECT_EQ(rowId, 1);
+
+    // the workers keep one of the three read connections free for the other reads
+    std::unique_ptr<AbsSharedResultSet> rstSet2 =
+        store->QuerySql("SELECT id, data1 FROM test ORDER BY id", selectionArgs);
+    ASSERT_NE(rstSet2, nullptr);
+    EXPECT_EQ(rstSet2->SetPrefetchNextBlock(true), E_OK);
+    EXPECT_EQ(rstSet2->GoToFirstRow(), E_OK);
+    std::unique_ptr<AbsSharedResultSet> rstSet3 =
+        store->QuerySql("SELECT id, data1 FROM test ORDER BY id", selectionArgs);
+    ASSERT_NE(rstSet3, nullptr);
+    EXPECT_EQ(rstSet3->SetPrefetchNextBlock(true), E_NOT_SUPPORT);
+    int64_t count = 0;
+    EXPECT_EQ(store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test"), E_OK);
+    EXPECT_EQ(count, rowCount);
+    EXPECT_EQ(rstSet3->Close(), E_OK);
+    EXPECT_EQ(rstSet2->Close(), E_OK);
+    EXPECT_EQ(rstSet->Close(), E_OK);
+}
+
+/* *
+ * @tc.name: Sqlite_Shared_Result_Set_023
+ * @tc.desc: normal testcase of SqliteSharedResultSet for windows prefetched inside a transaction
+ * @tc.type: FUNC
+ * @tc.require: AR000FKD4F
+ */
+HWTEST_F(RdbSqliteSharedResultSetTest, Sqlite_Shared_Result_Set_023, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbSqliteSharedResultSetTest::store;
+    const int rowCount = 600;
+    const std::string text(1000, 'c');
+    const std::string updatedText(1000, 'd');
+    int64_t id;
+    ValuesBucket values;
+    for (int i = 1; i <= rowCount; i++) {
+        values.Clear();
+        values.PutInt("id", i);
+        values.PutString("data1", text);
+        EXPECT_EQ(store->Insert(id, "test", values), E_OK);
+    }
+
+    // the read connections do not see the rows updated in the transaction, so every window is filled on its writer
+    EXPECT_EQ(store->BeginTransaction(), E_OK);
+    int changedRows = 0;
+    values.Clear();
+    values.PutString("data1", updatedText);
+    EXPECT_EQ(store->Update(changedRows, "test", values), E_OK);
+    EXPECT_EQ(changedRows, rowCount);
+
+    std::vector<std::string> selectionArgs;
+    std::unique_ptr<AbsSharedResultSet> rstSet =
+        store->QuerySql("SELECT id, data1 FROM test ORDER BY id", selectionArgs);
+    ASSERT_NE(rstSet, nullptr);
+    EXPECT_EQ(rstSet->SetPrefetchNextBlock(true), E_OK);
+    int rows = 0;
+    while (rstSet->GoToNextRow() == E_OK) {
+        std::string data1;
+        EXPECT_EQ(rstSet->GetString(1, data1), E_OK);
+        EXPECT_EQ(data1, updatedText);
+        rows++;
+    }
+    EXPECT_EQ(rows, rowCount);
+    AbsSharedResultSet::BlockStats stats;
+    EXPECT_EQ(rstSet->GetBlockStats(stats), E_OK);
+    EXPECT_GT(stats.fillCount, 1u);
+    EXPECT_EQ(rstSet->Close(), E_OK);
+    EXPECT_EQ(store->RollBack(), E_OK);
+}
@@ -15,8 +15,11 @@
 
 #include <gtest/gtest.h>
 
+#include <mutex>
+#include <set>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "common.h"
 #include "logger.h"
@@ -316,3 +319,89 @@ HWTEST_F(RdbConcurrentTest, RdbStore_Concurrent_001, TestSize.Level1)
     queryThread.join();
     EXPECT_EQ(insertResult, E_OK);
 }
+
+/**
+ * @tc.name: RdbStore_Concurrent_002
+ * @tc.desc: test that writes coalesced by the group commit keep their own row ids and result codes
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbConcurrentTest, RdbStore_Concurrent_002, TestSize.Level1)
+{
+    const std::string dbPath = RDB_TEST_PATH + "group_commit_test.db";
+    RdbStoreConfig config(dbPath);
+    EXPECT_EQ(config.SetGroupCommitWindow(-1), E_ERROR);
+    EXPECT_EQ(config.SetGroupCommitWindow(1001), E_ERROR);
+    EXPECT_EQ(config.SetGroupCommitWindow(5), E_OK);
+    EXPECT_EQ(config.GetGroupCommitWindow(), 5);
+    ConcurrentTestOpenCallback helper;
+    int errCode = E_OK;
+    std::shared_ptr<RdbStore> store = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    ASSERT_NE(store, nullptr);
+    EXPECT_EQ(errCode, E_OK);
+
+    const int threadCount = 8;
+    const int loopCount = 50;
+    std::mutex mutex;
+    std::set<int64_t> rowIds;
+    int failedCount = 0;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; i++) {
+        threads.emplace_back([&store, &mutex, &rowIds, &failedCount, i, loopCount]() {
+            ValuesBucket values;
+            for (int j = 0; j < loopCount; j++) {
+                values.Clear();
+                values.PutString("name", std::string("zhangsan"));
+                values.PutInt("age", i * loopCount + j);
+                int64_t id = -1;
+                int ret = store->Insert(id, "test", values);
+                std::lock_guard<std::mutex> lock(mutex);
+                failedCount += (ret != E_OK) ? 1 : 0;
+                rowIds.insert(id);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(failedCount, 0);
+    EXPECT_EQ(rowIds.size(), static_cast<size_t>(threadCount * loopCount));
+    int64_t count = 0;
+    EXPECT_EQ(store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test"), E_OK);
+    EXPECT_EQ(count, threadCount * loopCount);
+
+    // a conflicting write fails alone, the writes coalesced with it still succeed
+    std::vector<int> results(threadCount, E_OK);
+    threads.clear();
+    for (int i = 0; i < threadCount; i++) {
+        threads.emplace_back([&store, &results, i]() {
+            ValuesBucket values;
+            values.PutInt("id", (i == 0) ? 1 : 1000 + i);
+            values.PutString("name", std::string("lisi"));
+            int64_t id = -1;
+            results[i] = store->Insert(id, "test", values);
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_NE(results[0], E_OK);
+    for (int i = 1; i < threadCount; i++) {
+        EXPECT_EQ(results[i], E_OK);
+    }
+    EXPECT_EQ(store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test WHERE name = 'lisi'"), E_OK);
+    EXPECT_EQ(count, threadCount - 1);
+
+    ValuesBucket values;
+    values.PutString("name", std::string("wangwu"));
+    int changedRows = 0;
+    EXPECT_EQ(store->Update(changedRows, "test", values, "name = ?", std::vector<std::string>{ "lisi" }), E_OK);
+    EXPECT_EQ(changedRows, threadCount - 1);
+    int deletedRows = 0;
+    EXPECT_EQ(store->Delete(deletedRows, "test", "name = ?", std::vector<std::string>{ "wangwu" }), E_OK);
+    EXPECT_EQ(deletedRows, threadCount - 1);
+
+    store = nullptr;
+    RdbHelper::DeleteRdbStore(dbPath);
+}
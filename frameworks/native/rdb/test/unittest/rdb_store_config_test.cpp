@@ -15,13 +15,18 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <functional>
 #include <string>
+#include <thread>
 
 #include "common.h"
 #include "logger.h"
 #include "rdb_errno.h"
 #include "rdb_helper.h"
 #include "rdb_open_callback.h"
+#include "rdb_store_impl.h"
+#include "sys/stat.h"
 #include "unistd.h"
 
 using namespace testing::ext;
@@ -33,6 +38,7 @@ public:
     static void TearDownTestCase(void);
     void SetUp();
     void TearDown();
+    static bool WaitUntil(const std::function<bool()> &condition);
 };
 
 class ConfigTestOpenCallback : public RdbOpenCallback {
@@ -75,6 +81,22 @@ void RdbStoreConfigTest::TearDown(void)
     RdbHelper::ClearCache();
 }
 
+/**
+ * Waits until the background tasks of a store bring about the condition, so that the tests do not depend on how
+ * soon the task thread runs on a loaded machine.
+ */
+bool RdbStoreConfigTest::WaitUntil(const std::function<bool()> &condition)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
 /**
  * @tc.name: RdbStoreConfig_001
  * @tc.desc: test RdbStoreConfig
@@ -370,3 +392,374 @@ HWTEST_F(RdbStoreConfigTest, RdbStoreConfig_011, TestSize.Level1)
     EXPECT_EQ(ret, E_OK);
     EXPECT_EQ(currentMode, "off");
 }
+
+/**
+ * @tc.name: RdbStoreConfig_012
+ * @tc.desc: test RdbStoreConfig statementCacheSize
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbStoreConfigTest, RdbStoreConfig_012, TestSize.Level1)
+{
+    const std::string dbPath = RDB_TEST_PATH + "config_test.db";
+    RdbStoreConfig config(dbPath, StorageMode::MODE_DISK, false);
+    EXPECT_EQ(config.GetStatementCacheSize(), -1);
+    EXPECT_EQ(config.SetStatementCacheSize(-1), E_ERROR);
+    EXPECT_EQ(config.SetStatementCacheSize(101), E_ERROR);
+    EXPECT_EQ(config.SetStatementCacheSize(8), E_OK);
+    EXPECT_EQ(config.GetStatementCacheSize(), 8);
+    ConfigTestOpenCallback helper;
+    int errCode = E_OK;
+    std::shared_ptr<RdbStore> store = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    EXPECT_NE(store, nullptr);
+
+    auto storeImpl = std::static_pointer_cast<RdbStoreImpl>(store);
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    storeImpl->GetStatementCacheStats(hits, misses);
+    uint64_t oldHits = hits;
+
+    int64_t id;
+    ValuesBucket values;
+    for (int i = 0; i < 10; i++) {
+        values.Clear();
+        values.PutString("name", std::string("zhangsan"));
+        values.PutInt("age", i);
+        EXPECT_EQ(store->Insert(id, "test", values), E_OK);
+    }
+    storeImpl->GetStatementCacheStats(hits, misses);
+    EXPECT_GE(hits - oldHits, 9u);
+
+    int64_t count;
+    EXPECT_EQ(store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test"), E_OK);
+    EXPECT_EQ(count, 10);
+    EXPECT_EQ(store->ExecuteSql("DELETE FROM test"), E_OK);
+}
+
+/**
+ * @tc.name: RdbStoreConfig_013
+ * @tc.desc: test RdbStoreConfig read connection range and idle timeout
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbStoreConfigTest, RdbStoreConfig_013, TestSize.Level1)
+{
+    const std::string dbPath = RDB_TEST_PATH + "config_elastic_test.db";
+    RdbStoreConfig config(dbPath, StorageMode::MODE_DISK, false);
+    EXPECT_EQ(config.GetMinReadConnectionCount(), -1);
+    EXPECT_EQ(config.GetMaxReadConnectionCount(), -1);
+    EXPECT_EQ(config.GetReadConnectionIdleTimeout(), -1);
+    EXPECT_EQ(config.SetReadConnectionRange(-1, 2), E_ERROR);
+    EXPECT_EQ(config.SetReadConnectionRange(3, 2), E_ERROR);
+    EXPECT_EQ(config.SetReadConnectionRange(0, 33), E_ERROR);
+    EXPECT_EQ(config.SetReadConnectionIdleTimeout(-1), E_ERROR);
+    EXPECT_EQ(config.SetReadConnectionRange(0, 2), E_OK);
+    EXPECT_EQ(config.SetReadConnectionIdleTimeout(1000), E_OK);
+    EXPECT_EQ(config.GetMinReadConnectionCount(), 0);
+    EXPECT_EQ(config.GetMaxReadConnectionCount(), 2);
+    EXPECT_EQ(config.GetReadConnectionIdleTimeout(), 1000);
+
+    ConfigTestOpenCallback helper;
+    int errCode = E_OK;
+    std::shared_ptr<RdbStore> store = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    ASSERT_NE(store, nullptr);
+    int64_t id;
+    ValuesBucket values;
+    values.PutString("name", std::string("zhangsan"));
+    EXPECT_EQ(store->Insert(id, "test", values), E_OK);
+
+    // the reader opened while checking the version is closed after the idle timeout
+    auto storeImpl = std::static_pointer_cast<RdbStoreImpl>(store);
+    int total = -1;
+    int idle = -1;
+    EXPECT_TRUE(WaitUntil([&storeImpl, &total, &idle]() {
+        storeImpl->GetReadConnectionCount(total, idle);
+        return total == 0;
+    }));
+
+    std::unique_ptr<ResultSet> resultSet = store->QueryByStep("SELECT * FROM test");
+    ASSERT_NE(resultSet, nullptr);
+    resultSet->GoToFirstRow();
+    std::thread reader([store]() {
+        std::unique_ptr<ResultSet> otherSet = store->QueryByStep("SELECT * FROM test");
+        ASSERT_NE(otherSet, nullptr);
+        otherSet->GoToFirstRow();
+        otherSet->Close();
+    });
+    reader.join();
+    // the idle timeout is long enough that the reader just released is still open
+    storeImpl->GetReadConnectionCount(total, idle);
+    EXPECT_EQ(total, 2);
+    EXPECT_EQ(idle, 1);
+    resultSet->Close();
+
+    EXPECT_TRUE(WaitUntil([&storeImpl, &total, &idle]() {
+        storeImpl->GetReadConnectionCount(total, idle);
+        return total == 0;
+    }));
+    EXPECT_EQ(idle, 0);
+
+    int64_t count;
+    EXPECT_EQ(store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test"), E_OK);
+    EXPECT_EQ(count, 1);
+    RdbHelper::DeleteRdbStore(dbPath);
+}
+
+/**
+ * @tc.name: RdbStoreConfig_014
+ * @tc.desc: test RdbStoreConfig connection acquire timeout and the connection pool statistics
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbStoreConfigTest, RdbStoreConfig_014, TestSize.Level1)
+{
+    const std::string dbPath = RDB_TEST_PATH + "config_timeout_test.db";
+    RdbStoreConfig config(dbPath, StorageMode::MODE_DISK, false);
+    EXPECT_EQ(config.GetConnectionAcquireTimeout(), -1);
+    EXPECT_EQ(config.SetConnectionAcquireTimeout(-1), E_ERROR);
+    EXPECT_EQ(config.SetConnectionAcquireTimeout(100), E_OK);
+    EXPECT_EQ(config.GetConnectionAcquireTimeout(), 100);
+    EXPECT_EQ(config.SetReadConnectionRange(1, 1), E_OK);
+
+    ConfigTestOpenCallback helper;
+    int errCode = E_OK;
+    std::shared_ptr<RdbStore> store = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    ASSERT_NE(store, nullptr);
+    int64_t id;
+    ValuesBucket values;
+    values.PutString("name", std::string("zhangsan"));
+    EXPECT_EQ(store->Insert(id, "test", values), E_OK);
+
+    // the only read connection is held by the step result set
+    std::unique_ptr<ResultSet> resultSet = store->QueryByStep("SELECT * FROM test");
+    ASSERT_NE(resultSet, nullptr);
+    EXPECT_EQ(resultSet->GoToFirstRow(), E_OK);
+    int64_t count = 0;
+    std::thread reader([store, &errCode, &count]() {
+        errCode = store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test");
+    });
+    reader.join();
+    EXPECT_EQ(errCode, E_DATABASE_BUSY);
+    resultSet->Close();
+
+    std::thread otherReader([store, &errCode, &count]() {
+        errCode = store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test");
+    });
+    otherReader.join();
+    EXPECT_EQ(errCode, E_OK);
+    EXPECT_EQ(count, 1);
+
+    auto storeImpl = std::static_pointer_cast<RdbStoreImpl>(store);
+    ConnectionPoolStats writeStats;
+    ConnectionPoolStats readStats;
+    storeImpl->GetConnectionPoolStats(writeStats, readStats);
+    EXPECT_GT(writeStats.acquireCount, 0u);
+    EXPECT_EQ(writeStats.releaseCount, writeStats.acquireCount);
+    EXPECT_EQ(readStats.busyCount, 1u);
+    EXPECT_EQ(readStats.maxQueueDepth, 1);
+    EXPECT_GE(readStats.maxHoldTime, 100000);
+    uint64_t waitCount = 0;
+    for (auto bucketCount : readStats.waitTimeHistogram) {
+        waitCount += bucketCount;
+    }
+    EXPECT_EQ(waitCount, readStats.acquireCount);
+    RdbHelper::DeleteRdbStore(dbPath);
+}
+
+/**
+ * @tc.name: RdbStoreConfig_015
+ * @tc.desc: test RdbStoreConfig checkpoint policy and the background checkpoint statistics
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbStoreConfigTest, RdbStoreConfig_015, TestSize.Level1)
+{
+    const std::string dbPath = RDB_TEST_PATH + "config_checkpoint_test.db";
+    RdbStoreConfig config(dbPath, StorageMode::MODE_DISK, false);
+    EXPECT_EQ(config.GetCheckpointPolicy(), CheckpointPolicy::AUTO);
+    EXPECT_EQ(config.SetCheckpointPolicy(CheckpointPolicy::TRUNCATE), E_OK);
+    EXPECT_EQ(config.GetCheckpointPolicy(), CheckpointPolicy::TRUNCATE);
+    EXPECT_EQ(config.SetCheckpointThreshold(0, 100), E_ERROR);
+    EXPECT_EQ(config.SetCheckpointThreshold(100, -1), E_ERROR);
+    EXPECT_EQ(config.SetCheckpointThreshold(10000, 100), E_OK);
+    EXPECT_EQ(config.GetCheckpointWalPages(), 10000);
+    EXPECT_EQ(config.GetCheckpointIdleTime(), 100);
+
+    ConfigTestOpenCallback helper;
+    int errCode = E_OK;
+    std::shared_ptr<RdbStore> store = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    ASSERT_NE(store, nullptr);
+    auto storeImpl = std::static_pointer_cast<RdbStoreImpl>(store);
+    int64_t id;
+    ValuesBucket values;
+    values.PutString("name", std::string("zhangsan"));
+    values.PutBlob("blobType", std::vector<uint8_t>(8192, 1));
+    for (int i = 0; i < 200; i++) {
+        EXPECT_EQ(store->Insert(id, "test", values), E_OK);
+    }
+
+    // the writes do not checkpoint, far below the size threshold nothing happens before the store is idle
+    CheckpointStats stats;
+    storeImpl->GetCheckpointStats(stats);
+    EXPECT_EQ(stats.checkpointCount, 0u);
+    EXPECT_GT(stats.walPages, 200);
+
+    EXPECT_TRUE(WaitUntil([&storeImpl, &stats] {
+        storeImpl->GetCheckpointStats(stats);
+        return stats.checkpointCount > 0;
+    }));
+    EXPECT_EQ(stats.checkpointCount, 1u);
+    EXPECT_EQ(stats.incompleteCount, 0u);
+    EXPECT_GT(stats.checkpointedPages, 200u);
+    EXPECT_EQ(stats.walPages, 0);
+    struct stat fileStat;
+    EXPECT_EQ(stat((dbPath + "-wal").c_str(), &fileStat), 0);
+    EXPECT_EQ(fileStat.st_size, 0);
+
+    int64_t count = 0;
+    EXPECT_EQ(store->ExecuteAndGetLong(count, "SELECT COUNT(*) FROM test"), E_OK);
+    EXPECT_EQ(count, 200);
+    store = nullptr;
+    storeImpl = nullptr;
+    RdbHelper::ClearCache();
+
+    // past the size threshold the checkpoint runs without waiting for the store to be idle
+    EXPECT_EQ(config.SetCheckpointPolicy(CheckpointPolicy::PASSIVE), E_OK);
+    EXPECT_EQ(config.SetCheckpointThreshold(50, 60000), E_OK);
+    store = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    ASSERT_NE(store, nullptr);
+    storeImpl = std::static_pointer_cast<RdbStoreImpl>(store);
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(store->Insert(id, "test", values), E_OK);
+    }
+    EXPECT_TRUE(WaitUntil([&storeImpl, &stats] {
+        storeImpl->GetCheckpointStats(stats);
+        return stats.checkpointCount > 0 && stats.walPages < 50;
+    }));
+    store = nullptr;
+    storeImpl = nullptr;
+    RdbHelper::DeleteRdbStore(dbPath);
+}
+
+/**
+ * @tc.name: RdbStoreConfig_016
+ * @tc.desc: test RdbStoreConfig sqlite tuning of the write and read connections
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbStoreConfigTest, RdbStoreConfig_016, TestSize.Level1)
+{
+    const std::string dbPath = RDB_TEST_PATH + "config_tuning_test.db";
+    RdbStoreConfig config(dbPath, StorageMode::MODE_DISK, false);
+    SqliteTuning tuning;
+    tuning.pageSize = 1000;
+    EXPECT_EQ(config.SetWriteConnectionTuning(tuning), E_ERROR);
+    tuning.pageSize = 8192;
+    tuning.cacheSize = -2;
+    EXPECT_EQ(config.SetWriteConnectionTuning(tuning), E_ERROR);
+    tuning.cacheSize = 4096;
+    tuning.autoCheckpoint = 200;
+    EXPECT_EQ(config.SetWriteConnectionTuning(tuning), E_OK);
+    SqliteTuning readTuning;
+    readTuning.cacheSize = 512;
+    readTuning.tempStore = TempStore::MEMORY;
+    EXPECT_EQ(config.SetReadConnectionTuning(readTuning), E_OK);
+    EXPECT_EQ(config.GetWriteConnectionTuning().cacheSize, 4096);
+    EXPECT_EQ(config.GetReadConnectionTuning().tempStore, TempStore::MEMORY);
+    EXPECT_EQ(RdbStoreConfig(config).GetReadConnectionTuning().cacheSize, 512);
+
+    ConfigTestOpenCallback helper;
+    int errCode = E_OK;
+    std::shared_ptr<RdbStore> store = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    ASSERT_NE(store, nullptr);
+
+    // the queries outside a transaction run on a read connection
+    int64_t value = 0;
+    EXPECT_EQ(store->ExecuteAndGetLong(value, "PRAGMA cache_size"), E_OK);
+    EXPECT_EQ(value, -512);
+    EXPECT_EQ(store->ExecuteAndGetLong(value, "PRAGMA temp_store"), E_OK);
+    EXPECT_EQ(value, 2);
+
+    EXPECT_EQ(store->ExecuteAndGetLong(value, "PRAGMA wal_autocheckpoint"), E_OK);
+    EXPECT_NE(value, 200);
+    store = nullptr;
+    RdbHelper::ClearCache();
+
+    // without read connections they run on the write connection
+    EXPECT_EQ(config.SetReadConnectionRange(0, 0), E_OK);
+    store = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    ASSERT_NE(store, nullptr);
+    EXPECT_EQ(store->ExecuteAndGetLong(value, "PRAGMA cache_size"), E_OK);
+    EXPECT_EQ(value, -4096);
+    EXPECT_EQ(store->ExecuteAndGetLong(value, "PRAGMA page_size"), E_OK);
+    EXPECT_EQ(value, 8192);
+    EXPECT_EQ(store->ExecuteAndGetLong(value, "PRAGMA wal_autocheckpoint"), E_OK);
+    EXPECT_EQ(value, 200);
+    EXPECT_EQ(store->ExecuteAndGetLong(value, "PRAGMA temp_store"), E_OK);
+    EXPECT_EQ(value, 0);
+    store = nullptr;
+    RdbHelper::DeleteRdbStore(dbPath);
+}
+
+/**
+ * @tc.name: RdbStoreConfig_017
+ * @tc.desc: test RdbStoreConfig memory mapping of the read connections across restores
+ * @tc.type: FUNC
+ * @tc.require: AR000CU2BO
+ * @tc.author: chenxi
+ */
+HWTEST_F(RdbStoreConfigTest, RdbStoreConfig_017, TestSize.Level1)
+{
+    const std::string dbPath = RDB_TEST_PATH + "config_mmap_test.db";
+    const std::string backupPath = RDB_TEST_PATH + "config_mmap_backup.db";
+    const int64_t mmapSizeLimit = 1024 * 1024;
+    RdbStoreConfig config(dbPath, StorageMode::MODE_DISK, false);
+    EXPECT_FALSE(config.IsReadConnectionMmapEnabled());
+    EXPECT_EQ(config.SetReadConnectionMmap(true, 0), E_ERROR);
+    EXPECT_EQ(config.SetReadConnectionMmap(true, mmapSizeLimit), E_OK);
+    EXPECT_TRUE(config.IsReadConnectionMmapEnabled());
+    EXPECT_EQ(config.GetReadConnectionMmapSizeLimit(), mmapSizeLimit);
+
+    ConfigTestOpenCallback helper;
+    int errCode = E_OK;
+    const std::vector<uint8_t> backupKey{ 1, 2, 3 };
+    auto createBackup = [&backupPath, &helper, &errCode](const std::vector<uint8_t> &key) {
+        RdbStoreConfig backupConfig(backupPath);
+        backupConfig.SetEncryptKey(key);
+        std::shared_ptr<RdbStore> backupStore = RdbHelper::GetRdbStore(backupConfig, 1, helper, errCode);
+        ASSERT_NE(backupStore, nullptr);
+        int64_t id;
+        ValuesBucket values;
+        values.PutString("name", std::string("lisi"));
+        EXPECT_EQ(backupStore->Insert(id, "test", values), E_OK);
+        backupStore = nullptr;
+        RdbHelper::ClearCache();
+    };
+    std::shared_ptr<RdbStore> store = RdbHelper::GetRdbStore(config, 1, helper, errCode);
+    ASSERT_NE(store, nullptr);
+    int64_t value = 0;
+    EXPECT_EQ(store->ExecuteAndGetLong(value, "PRAGMA mmap_size"), E_OK);
+    EXPECT_EQ(value, mmapSizeLimit);
+    createBackup(backupKey);
+
+    // the connections reopened on the restored file do not map it once it is encrypted
+    EXPECT_EQ(store->ChangeDbFileForRestore(dbPath, backupPath, backupKey), E_OK);
+    EXPECT_EQ(store->ExecuteAndGetLong(value, "PRAGMA mmap_size"), E_OK);
+    EXPECT_EQ(value, 0);
+    EXPECT_EQ(store->ExecuteAndGetLong(value, "SELECT COUNT(*) FROM test"), E_OK);
+    EXPECT_EQ(value, 1);
+
+    createBackup(std::vector<uint8_t>());
+    EXPECT_EQ(store->ChangeDbFileForRestore(dbPath, backupPath, std::vector<uint8_t>()), E_OK);
+    EXPECT_EQ(store->ExecuteAndGetLong(value, "PRAGMA mmap_size"), E_OK);
+    EXPECT_EQ(value, mmapSizeLimit);
+    EXPECT_EQ(store->ExecuteAndGetLong(value, "SELECT COUNT(*) FROM test"), E_OK);
+    EXPECT_EQ(value, 1);
+    store = nullptr;
+    RdbHelper::DeleteRdbStore(dbPath);
+}
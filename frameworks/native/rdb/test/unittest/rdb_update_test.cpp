@@ -1056,3 +1056,72 @@ HWTEST_F(RdbStoreUpdateTest, RdbStore_UpdateWithConflictResolution_006, TestSize
     ret = resultSet->Close();
     EXPECT_EQ(ret, E_OK);
 }
+
+/**
+ * @tc.name: RdbStore_BatchUpdate_001
+ * @tc.desc: test RdbStore BatchUpdate, items of different shapes in one transaction with the count of each item
+ * @tc.type: FUNC
+ */
+HWTEST_F(RdbStoreUpdateTest, RdbStore_BatchUpdate_001, TestSize.Level1)
+{
+    std::shared_ptr<RdbStore> &store = RdbStoreUpdateTest::store;
+
+    int64_t id;
+    ValuesBucket values;
+    for (int i = 1; i <= 3; i++) {
+        values.Clear();
+        values.PutInt("id", i);
+        values.PutString("name", "name" + std::to_string(i));
+        values.PutInt("age", 18);
+        EXPECT_EQ(store->Insert(id, "test", values), E_OK);
+    }
+
+    std::vector<std::pair<ValuesBucket, AbsRdbPredicates>> updates;
+    for (int i = 1; i <= 4; i++) {
+        values.Clear();
+        values.PutInt("age", 20 + i);
+        AbsRdbPredicates predicates("test");
+        predicates.EqualTo("id", std::to_string(i));
+        updates.emplace_back(values, predicates);
+    }
+    values.Clear();
+    values.PutDouble("salary", 100.5);
+    AbsRdbPredicates adults("test");
+    adults.GreaterThan("age", "21");
+    updates.emplace_back(values, adults);
+
+    std::vector<int64_t> changedRows;
+    int ret = store->BatchUpdate(changedRows, updates);
+    EXPECT_EQ(ret, E_OK);
+    EXPECT_EQ(changedRows, (std::vector<int64_t>{ 1, 1, 1, 0, 2 }));
+
+    std::unique_ptr<ResultSet> resultSet =
+        store->QuerySql("SELECT COUNT(*) FROM test WHERE age = id + 20 AND (salary IS NULL) = (id = 1)");
+    EXPECT_NE(resultSet, nullptr);
+    EXPECT_EQ(resultSet->GoToFirstRow(), E_OK);
+    int count = 0;
+    resultSet->GetInt(0, count);
+    EXPECT_EQ(count, 3);
+    resultSet->Close();
+
+    // the unique name makes the second item fail, so the first one is rolled back as well
+    updates.clear();
+    values.Clear();
+    values.PutInt("age", 50);
+    AbsRdbPredicates first("test");
+    first.EqualTo("id", "1");
+    updates.emplace_back(values, first);
+    values.Clear();
+    values.PutString("name", "name1");
+    AbsRdbPredicates second("test");
+    second.EqualTo("id", "2");
+    updates.emplace_back(values, second);
+    ret = store->BatchUpdate(changedRows, updates);
+    EXPECT_EQ(ret, RdbStoreUpdateTest::E_SQLITE_CONSTRAINT);
+    EXPECT_TRUE(changedRows.empty());
+
+    int64_t age = 0;
+    ret = store->ExecuteAndGetLong(age, "SELECT age FROM test WHERE id = 1");
+    EXPECT_EQ(ret, E_OK);
+    EXPECT_EQ(age, 21);
+}
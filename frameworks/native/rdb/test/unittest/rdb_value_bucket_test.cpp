@@ -19,6 +19,7 @@
 
 #include "logger.h"
 #include "parcel.h"
+#include "rdb_errno.h"
 #include "value_object.h"
 #include "values_bucket.h"
 #include "message_parcel.h"
@@ -208,3 +209,54 @@ HWTEST_F(ValuesBucketTest, Values_Bucket_004, TestSize.Level1)
     values.Unmarshalling(parcel)->Clear();
     EXPECT_EQ(true, values.Unmarshalling(parcel)->IsEmpty());
 }
+
+/**
+ * @tc.name: Values_Bucket_005
+ * @tc.desc: test the string and blob views of ValueObject
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValuesBucketTest, Values_Bucket_005, TestSize.Level1)
+{
+    ValueObject strObject(std::string("zhangsan"));
+    std::string_view strView;
+    EXPECT_EQ(E_OK, strObject.GetStringView(strView));
+    EXPECT_EQ("zhangsan", strView);
+
+    ValueObject blobObject(std::vector<uint8_t>{ 1, 2, 3 });
+    const uint8_t *blob = nullptr;
+    size_t size = 0;
+    EXPECT_EQ(E_OK, blobObject.GetBlobView(blob, size));
+    EXPECT_EQ((size_t)3, size);
+    EXPECT_EQ(1, blob[0]);
+    EXPECT_EQ(3, blob[2]);
+
+    EXPECT_EQ(E_INVALID_OBJECT_TYPE, strObject.GetBlobView(blob, size));
+    EXPECT_EQ(E_INVALID_OBJECT_TYPE, blobObject.GetStringView(strView));
+}
+
+/**
+ * @tc.name: Values_Bucket_006
+ * @tc.desc: test ForEach visits the columns of ValuesBucket in ascending order
+ * @tc.type: FUNC
+ */
+HWTEST_F(ValuesBucketTest, Values_Bucket_006, TestSize.Level1)
+{
+    ValuesBucket values;
+    values.PutString("name", std::string("zhangsan"));
+    values.PutInt("age", 18);
+    values.PutNull("salary");
+
+    std::vector<std::string> columns;
+    values.ForEach([&columns](const std::string &column, const ValueObject &value) {
+        columns.push_back(column);
+        if (column == "age") {
+            int age = 0;
+            EXPECT_EQ(E_OK, value.GetInt(age));
+            EXPECT_EQ(18, age);
+        }
+    });
+    ASSERT_EQ((size_t)3, columns.size());
+    EXPECT_EQ("age", columns[0]);
+    EXPECT_EQ("name", columns[1]);
+    EXPECT_EQ("salary", columns[2]);
+}
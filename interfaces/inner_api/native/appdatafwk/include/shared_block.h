@@ -19,6 +19,7 @@
 #include <cinttypes>
 
 #include <string>
+#include <vector>
 #include <ashmem.h>
 #include "message_parcel.h"
 #include "parcel.h"
@@ -65,6 +66,17 @@ public:
         } cell;
     } __attribute((packed));
 
+    /**
+     * A column the block also keeps column-major. The value of row i is longs[i] or doubles[i] as types[i] tells,
+     * rows of the other types only have their type here.
+     */
+    struct ColumnView {
+        const uint8_t *types;
+        const int64_t *longs;
+        const double *doubles;
+        uint32_t rowNum;
+    };
+
     /**
      * SharedBlock constructor.
      */
@@ -85,6 +97,34 @@ public:
      */
     static int Create(const std::string &name, size_t size, SharedBlock *&outSharedBlock);
 
+    /* Counters of the block pool of the process. */
+    struct PoolStats {
+        uint64_t createCount;
+        uint64_t reuseCount;
+        uint64_t dropCount;
+        size_t idleBytes;
+    };
+
+    /**
+     * Lease a block of at least size bytes from the pool of the process, a new one is created if none is idle.
+     */
+    static int Lease(const std::string &name, size_t size, SharedBlock *&outSharedBlock);
+
+    /**
+     * Give a block back to the pool. Blocks not leased, blocks sent to other processes and blocks over the
+     * capacity of the pool are deleted instead. A block written to a MessageParcel is never reused, as the
+     * process reading it may map it until it closes its result set, so blocks always sent elsewhere, like
+     * those of the DataShare writers, are created rather than leased.
+     */
+    static void Release(SharedBlock *block);
+
+    /**
+     * Set the bytes the idle blocks of the pool may take, idle blocks over it are deleted.
+     */
+    static void SetPoolCapacity(size_t capacity);
+
+    static PoolStats GetPoolStats();
+
     /**
      * Clear current shared block.
      */
@@ -95,6 +135,17 @@ public:
      */
     int SetColumnNum(uint32_t numColumns);
 
+    /**
+     * Keep the INTEGER and FLOAT values of these columns column-major as well, from the next SetColumnNum after
+     * a clear on. Old peers still read the block by its cells.
+     */
+    void SetColumnarColumns(const std::vector<uint32_t> &columns);
+
+    /**
+     * Gets the column-major values of the column, false if the block does not keep them.
+     */
+    bool GetColumnView(uint32_t column, ColumnView &view);
+
     /**
      * Allocate a row unit and its directory.
      */
@@ -170,6 +221,11 @@ public:
         return mHeader->unusedOffset;
     }
 
+    /**
+     * Size of the bytes reserved for the column-major arrays, 0 if the block is row-major.
+     */
+    size_t GetColumnarBytes();
+
     /**
      * The name of the current result set.
      */
@@ -186,6 +242,14 @@ public:
         return mSize;
     }
 
+    /**
+     * Whether the block was written to a parcel, or its fd was handed out, so that a peer maps it.
+     */
+    bool IsShared()
+    {
+        return mShared;
+    }
+
     /**
      * The row number of the current result set.
      */
@@ -194,6 +258,16 @@ public:
         return mHeader->rowNums;
     }
 
+    /**
+     * The row of the result set held by the first row of the block, 0 for blocks written by older peers.
+     */
+    uint32_t GetStartPos();
+
+    /**
+     * Set the row of the result set held by the first row of the block, reset to 0 by a clear.
+     */
+    void SetStartPos(uint32_t startPos);
+
     /**
      * The column number of the current result set.
      */
@@ -210,13 +284,14 @@ public:
      */
     size_t SetRawData(const void *rawData, size_t size);
     /**
-     * The fd of shared memory
+     * The fd of shared memory, the block is shared from then on.
      */
     int GetFd()
     {
         if (ashmem_ == nullptr) {
             return -1;
         }
+        mShared = true;
         return ashmem_->GetAshmemFd();
     }
     
@@ -226,6 +301,9 @@ private:
     void *mData;
     size_t mSize;
     bool mReadOnly;
+    /* Leased from the pool, and not sent to another process, which may still map it. */
+    bool mPooled;
+    bool mShared;
     static const size_t ROW_OFFSETS_NUM = 100;
     /**
     * Default setting for SQLITE_MAX_COLUMN is 2000.
@@ -244,12 +322,41 @@ private:
         uint32_t columnNums;
     };
 
+    /**
+     * Written after the header by this version, peers that do not know it skip it through firstRowGroupOffset.
+     */
+    struct SharedBlockHeaderExt {
+        /* Incremented by every clear, so that readers know when the row groups they cached are stale. */
+        uint32_t generation;
+        /* Number of the columns kept column-major, and the offset of their ColumnarDir array. */
+        uint32_t columnarNum;
+        uint32_t columnarDirOffset;
+        /* The rows the column-major arrays have room for. */
+        uint32_t columnarCapacity;
+        /* The row of the result set held by the first row of the block. */
+        uint32_t startPos;
+    };
+
+    struct ColumnarDir {
+        uint32_t column;
+        /* Offset of the int64_t or double values, aligned to 8 bytes. */
+        uint32_t valuesOffset;
+        /* Offset of the uint8_t types. */
+        uint32_t typesOffset;
+    };
+
     struct RowGroupHeader {
         uint32_t rowOffsets[ROW_OFFSETS_NUM];
         uint32_t nextGroupOffset;
     };
 
     SharedBlockHeader *mHeader;
+    /* Offsets of the row groups found so far, the group at index i holds the rows from i * ROW_OFFSETS_NUM. */
+    std::vector<uint32_t> mGroupOffsets;
+    /* Generation of the block when mGroupOffsets was built, -1 when the block does not count generations. */
+    int64_t mGeneration;
+    /* The columns this writer keeps column-major. */
+    std::vector<uint32_t> mColumnarColumns;
 
     /**
      * Allocate a portion of the block. Returns the offset of the allocation.
@@ -257,12 +364,20 @@ private:
      */
     uint32_t Alloc(size_t size, bool aligned = false);
 
+    SharedBlockHeaderExt *GetHeaderExt();
+
+    RowGroupHeader *GetRowGroup(uint32_t index);
+
     uint32_t *GetRowOffset(uint32_t row);
 
     uint32_t *AllocRowOffset();
 
     int PutBlobOrString(uint32_t row, uint32_t column, const void *value, size_t size, int32_t type);
 
+    void AllocColumnar();
+
+    void PutColumnar(uint32_t row, uint32_t column, int32_t type, const void *value);
+
     static int CreateSharedBlock(const std::string &name, size_t size, sptr<Ashmem> ashmem,
         SharedBlock *&outSharedBlock);
 
@@ -19,6 +19,8 @@
 #include <string>
 #include <vector>
 
+#include "value_object.h"
+
 namespace OHOS {
 namespace NativeRdb {
 class AbsPredicates {
@@ -36,6 +38,8 @@ public:
     void SetWhereClause(std::string whereClause);
     std::vector<std::string> GetWhereArgs() const;
     void SetWhereArgs(std::vector<std::string> whereArgs);
+    std::vector<ValueObject> GetBindArgs() const;
+    void SetBindArgs(std::vector<ValueObject> bindArgs);
     std::string GetOrder() const;
     void SetOrder(std::string order);
     int GetLimit() const;
@@ -77,9 +81,30 @@ public:
     virtual AbsPredicates *In(std::string field, std::vector<std::string> values);
     virtual AbsPredicates *NotIn(std::string field, std::vector<std::string> values);
 
+    virtual AbsPredicates *EqualTo(std::string field, ValueObject value);
+    virtual AbsPredicates *NotEqualTo(std::string field, ValueObject value);
+    virtual AbsPredicates *Between(std::string field, ValueObject low, ValueObject high);
+    virtual AbsPredicates *NotBetween(std::string field, ValueObject low, ValueObject high);
+    virtual AbsPredicates *GreaterThan(std::string field, ValueObject value);
+    virtual AbsPredicates *LessThan(std::string field, ValueObject value);
+    virtual AbsPredicates *GreaterThanOrEqualTo(std::string field, ValueObject value);
+    virtual AbsPredicates *LessThanOrEqualTo(std::string field, ValueObject value);
+    virtual AbsPredicates *In(std::string field, std::vector<ValueObject> values);
+    virtual AbsPredicates *NotIn(std::string field, std::vector<ValueObject> values);
+
+    /**
+     * Matches against a set of any size. Sets larger than LARGE_SET_THRESHOLD are bound as a single
+     * JSON array read back through json_each(), so the statement keeps one placeholder; smaller sets,
+     * sets holding blobs or non-finite doubles, and SQLite built without JSON fall back to In() and NotIn().
+     */
+    virtual AbsPredicates *InLargeSet(std::string field, std::vector<ValueObject> values);
+    virtual AbsPredicates *NotInLargeSet(std::string field, std::vector<ValueObject> values);
+
+    static constexpr size_t LARGE_SET_THRESHOLD = 64;
+
 private:
     std::string whereClause;
-    std::vector<std::string> whereArgs;
+    std::vector<ValueObject> bindArgs;
     std::string order;
     std::string group;
     std::string index;
@@ -94,8 +119,14 @@ private:
     std::string RemoveQuotes(std::string source) const;
     std::string Normalized(std::string source);
     void CheckIsNeedAnd();
-    void AppendWhereClauseWithInOrNotIn(std::string methodName, std::string field,
-        std::vector<std::string> replaceValues);
+    void AppendWhereClauseWithInOrNotIn(std::string methodName, std::string field, size_t count);
+    AbsPredicates *AppendCompare(std::string methodName, std::string field, std::string op, ValueObject value);
+    AbsPredicates *AppendRange(std::string methodName, std::string field, std::string op, ValueObject low,
+        ValueObject high);
+    AbsPredicates *AppendInOrNotIn(std::string methodName, std::string field, std::string op,
+        std::vector<ValueObject> values);
+    AbsPredicates *AppendInOrNotInLargeSet(std::string methodName, std::string field, std::string op,
+        std::vector<ValueObject> values);
 };
 } // namespace NativeRdb
 } // namespace OHOS
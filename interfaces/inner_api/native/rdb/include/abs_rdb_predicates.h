@@ -39,6 +39,27 @@ public:
 
     AbsRdbPredicates* EqualTo(std::string field, std::string value) override;
     AbsRdbPredicates* NotEqualTo(std::string field, std::string value) override;
+    AbsRdbPredicates* EqualTo(std::string field, ValueObject value) override;
+    AbsRdbPredicates* NotEqualTo(std::string field, ValueObject value) override;
+    /* The distributed predicates have no range operators, synchronizing skips ranges and sets of several values. */
+    using AbsPredicates::Between;
+    using AbsPredicates::NotBetween;
+    using AbsPredicates::GreaterThan;
+    using AbsPredicates::LessThan;
+    using AbsPredicates::GreaterThanOrEqualTo;
+    using AbsPredicates::LessThanOrEqualTo;
+    using AbsPredicates::In;
+    using AbsPredicates::NotIn;
+    AbsRdbPredicates* Between(std::string field, ValueObject low, ValueObject high) override;
+    AbsRdbPredicates* NotBetween(std::string field, ValueObject low, ValueObject high) override;
+    AbsRdbPredicates* GreaterThan(std::string field, ValueObject value) override;
+    AbsRdbPredicates* LessThan(std::string field, ValueObject value) override;
+    AbsRdbPredicates* GreaterThanOrEqualTo(std::string field, ValueObject value) override;
+    AbsRdbPredicates* LessThanOrEqualTo(std::string field, ValueObject value) override;
+    AbsRdbPredicates* In(std::string field, std::vector<ValueObject> values) override;
+    AbsRdbPredicates* NotIn(std::string field, std::vector<ValueObject> values) override;
+    AbsRdbPredicates* InLargeSet(std::string field, std::vector<ValueObject> values) override;
+    AbsRdbPredicates* NotInLargeSet(std::string field, std::vector<ValueObject> values) override;
     AbsRdbPredicates* And() override;
     AbsRdbPredicates* Or() override;
     AbsRdbPredicates* OrderByAsc(std::string field) override;
@@ -66,6 +87,7 @@ protected:
 private:
     std::string tableName;
     mutable DistributedRdb::RdbPredicates predicates_;
+    bool hasLocalCondition_ = false;
 };
 } // namespace OHOS::NativeRdb
 
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "result_set.h"
 
@@ -50,6 +51,7 @@ public:
     int IsEnded(bool &result) override;
     int GetColumnCount(int &count) override;
     int GetColumnIndex(const std::string &columnName, int &columnIndex) override;
+    int GetColumnIndexes(const std::vector<std::string> &columnNames, std::vector<int> &columnIndexes) override;
     int GetColumnName(int columnIndex, std::string &columnName) override;
     bool IsClosed() const override;
     int Close() override;
@@ -60,6 +62,15 @@ protected:
     int rowPos;
     // Indicates whether the result set is closed
     bool isClosed;
+
+private:
+    int InitColumnIndex();
+    static std::string ToColumnKey(const std::string &columnName);
+
+    // The column names and the index of each lower case name, obtained once from GetAllColumnNames
+    bool isColumnIndexReady;
+    std::vector<std::string> columnNameCache;
+    std::unordered_map<std::string, int> columnIndexMap;
 };
 } // namespace NativeRdb
 } // namespace OHOS
@@ -31,8 +31,21 @@ namespace OHOS {
 namespace NativeRdb {
 class AbsSharedResultSet : public AbsResultSet, public SharedResultSet {
 public:
+    /**
+     * Counters of the blocks filled so far. rowWidth is an exponential average of the bytes per row of each
+     * filled block, every fill halving the weight of the earlier ones.
+     */
+    struct BlockStats {
+        size_t rowWidth = 0;
+        uint64_t fillCount = 0;
+        size_t firstBlockSize = 0;
+        size_t lastBlockSize = 0;
+        size_t maxBlockSize = 0;
+    };
+
     AbsSharedResultSet();
     explicit AbsSharedResultSet(std::string name);
+    AbsSharedResultSet(std::string name, size_t blockSize);
     virtual ~AbsSharedResultSet();
     int GetBlob(int columnIndex, std::vector<uint8_t> &blob) override;
     int GetString(int columnIndex, std::string &value) override;
@@ -50,9 +63,37 @@ public:
     virtual void SetBlock(AppDataFwk::SharedBlock *block);
     int Close() override;
     bool HasBlock() const;
+    /**
+     * Keeps the INTEGER and FLOAT values of these columns column-major in the blocks filled afterwards, so that
+     * GetColumnView can read them as arrays. Only result sets that fill their own block support it, before the
+     * first row is read.
+     */
+    virtual int SetColumnarColumns(const std::vector<int> &columnIndexes);
+    /**
+     * Gets the column-major values of the column in the current block, indexed by the rows of the block, the
+     * first of which is the row GetStartPos of the block.
+     */
+    int GetColumnView(int columnIndex, AppDataFwk::SharedBlock::ColumnView &view);
+    /**
+     * Bounds the size of the blocks picked from the measured row width for the windows after the first one. Only
+     * result sets that fill their own block support it.
+     */
+    virtual int SetBlockSizeLimits(size_t minBlockSize, size_t maxBlockSize);
+    /**
+     * Gets the counters of the blocks this result set filled. Only result sets that fill their own block support it.
+     */
+    virtual int GetBlockStats(BlockStats &stats) const;
+    /**
+     * Fills the next window on a worker thread while the current one is read, for cursors that only move forward.
+     * The windows read inside a transaction are filled synchronously. Only result sets that fill their own block
+     * support it.
+     */
+    virtual int SetPrefetchNextBlock(bool isPrefetch);
 
 protected:
     int CheckState(int columnIndex);
+    bool IsRowInBlock(int position) const;
+    AppDataFwk::SharedBlock *ExchangeBlock(AppDataFwk::SharedBlock *block);
     void ClearBlock();
     void ClosedBlock();
     virtual void Finalize();
@@ -67,6 +108,8 @@ private:
     static const int INIT_POS = -1;
     static const size_t DEFAULT_BLOCK_SIZE = 2 * 1024 * 1024;
 
+    AppDataFwk::SharedBlock::CellUnit *GetCurrentCellUnit(int columnIndex);
+
     // The SharedBlock owned by this AbsSharedResultSet
     AppDataFwk::SharedBlock *sharedBlock_  = nullptr;
 };
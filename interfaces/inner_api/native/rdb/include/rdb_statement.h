@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NATIVE_RDB_RDB_STATEMENT_H
+#define NATIVE_RDB_RDB_STATEMENT_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abs_shared_result_set.h"
+#include "value_object.h"
+
+namespace OHOS {
+namespace NativeRdb {
+/**
+ * A statement obtained from {@link RdbStore#Prepare}. The sql is classified once and stays prepared on each
+ * connection of the store that runs it, so repeated executions skip parsing. Not thread safe, the bound
+ * values belong to the statement object.
+ */
+class RdbStatement {
+public:
+    virtual ~RdbStatement() {}
+    /**
+     * Binds the value of the placeholder at index, counting from 0.
+     */
+    virtual int Bind(int index, const ValueObject &value) = 0;
+    /**
+     * Replaces the values of all placeholders.
+     */
+    virtual int BindArgs(const std::vector<ValueObject> &bindArgs) = 0;
+    /**
+     * Sets all placeholders back to null.
+     */
+    virtual void ClearBindings() = 0;
+    virtual int Execute() = 0;
+    virtual int ExecuteForLastInsertedRowId(int64_t &outRowId) = 0;
+    virtual int ExecuteForChangedRowCount(int64_t &outValue) = 0;
+    virtual int ExecuteGetLong(int64_t &outValue) = 0;
+    virtual std::unique_ptr<AbsSharedResultSet> Query() = 0;
+    virtual std::string GetSql() const = 0;
+    virtual int GetParameterCount() const = 0;
+    virtual bool IsReadOnly() const = 0;
+};
+} // namespace NativeRdb
+} // namespace OHOS
+
+#endif
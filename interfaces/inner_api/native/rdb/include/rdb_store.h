@@ -18,10 +18,12 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "abs_rdb_predicates.h"
 #include "abs_shared_result_set.h"
+#include "rdb_statement.h"
 #include "result_set.h"
 #include "value_object.h"
 #include "values_bucket.h"
@@ -52,6 +54,16 @@ public:
     virtual int InsertWithConflictResolution(int64_t &outRowId, const std::string &table,
         const ValuesBucket &initialValues,
         ConflictResolution conflictResolution = ConflictResolution::ON_CONFLICT_NONE) = 0;
+    virtual int BatchInsert(int64_t &outInsertNum, const std::string &table,
+        const std::vector<ValuesBucket> &values) = 0;
+    /**
+     * Inserts the row, or updates the updateColumns of the row that conflicts with it on the conflictColumns.
+     * All columns of values other than the conflictColumns are updated when updateColumns is empty.
+     */
+    virtual int Upsert(int64_t &outChangedRows, const std::string &table, const ValuesBucket &values,
+        const std::vector<std::string> &conflictColumns, const std::vector<std::string> &updateColumns) = 0;
+    virtual int BatchUpsert(int64_t &outChangedRows, const std::string &table, const std::vector<ValuesBucket> &values,
+        const std::vector<std::string> &conflictColumns, const std::vector<std::string> &updateColumns) = 0;
     virtual int Update(int &changedRows, const std::string &table, const ValuesBucket &values,
         const std::string &whereClause = "",
         const std::vector<std::string> &whereArgs = std::vector<std::string>()) = 0;
@@ -60,6 +72,13 @@ public:
         ConflictResolution conflictResolution = ConflictResolution::ON_CONFLICT_NONE) = 0;
     virtual int Delete(int &deletedRows, const std::string &table, const std::string &whereClause = "",
         const std::vector<std::string> &whereArgs = std::vector<std::string>()) = 0;
+    virtual int Update(int &changedRows, const std::string &table, const ValuesBucket &values,
+        const std::string &whereClause, const std::vector<ValueObject> &bindArgs) = 0;
+    virtual int UpdateWithConflictResolution(int &changedRows, const std::string &table, const ValuesBucket &values,
+        const std::string &whereClause, const std::vector<ValueObject> &bindArgs,
+        ConflictResolution conflictResolution = ConflictResolution::ON_CONFLICT_NONE) = 0;
+    virtual int Delete(int &deletedRows, const std::string &table, const std::string &whereClause,
+        const std::vector<ValueObject> &bindArgs) = 0;
     virtual std::unique_ptr<AbsSharedResultSet> Query(int &errCode, bool distinct, const std::string &table,
         const std::vector<std::string> &columns, const std::string &selection = "",
         const std::vector<std::string> &selectionArgs = std::vector<std::string>(), const std::string &groupBy = "",
@@ -68,6 +87,10 @@ public:
         const std::string &sql, const std::vector<std::string> &selectionArgs = std::vector<std::string>()) = 0;
     virtual std::unique_ptr<ResultSet> QueryByStep(
         const std::string &sql, const std::vector<std::string> &selectionArgs = std::vector<std::string>()) = 0;
+    virtual std::unique_ptr<AbsSharedResultSet> QuerySql(
+        const std::string &sql, const std::vector<ValueObject> &bindArgs) = 0;
+    virtual std::unique_ptr<ResultSet> QueryByStep(
+        const std::string &sql, const std::vector<ValueObject> &bindArgs) = 0;
     virtual int ExecuteSql(
         const std::string &sql, const std::vector<ValueObject> &bindArgs = std::vector<ValueObject>()) = 0;
     virtual int ExecuteAndGetLong(int64_t &outValue, const std::string &sql,
@@ -78,6 +101,10 @@ public:
         const std::vector<ValueObject> &bindArgs = std::vector<ValueObject>()) = 0;
     virtual int ExecuteForChangedRowCount(int64_t &outValue, const std::string &sql,
         const std::vector<ValueObject> &bindArgs = std::vector<ValueObject>()) = 0;
+    /**
+     * Prepares the sql once for repeated executions with different bound values.
+     */
+    virtual std::shared_ptr<RdbStatement> Prepare(int &errCode, const std::string &sql) = 0;
     virtual int Backup(const std::string databasePath, const std::vector<uint8_t> destEncryptKey) = 0;
     virtual int Attach(
         const std::string &alias, const std::string &pathName, const std::vector<uint8_t> destEncryptKey) = 0;
@@ -87,6 +114,17 @@ public:
         const AbsRdbPredicates &predicates, const std::vector<std::string> columns) = 0;
     virtual int Update(int &changedRows, const ValuesBucket &values, const AbsRdbPredicates &predicates) = 0;
     virtual int Delete(int &deletedRows, const AbsRdbPredicates &predicates) = 0;
+    /**
+     * Applies every update in one transaction, each item updating the rows its predicates select with its values.
+     * changedRows receives the count of each item in the order of updates. Nothing is applied if any item fails.
+     */
+    virtual int BatchUpdate(std::vector<int64_t> &changedRows,
+        const std::vector<std::pair<ValuesBucket, AbsRdbPredicates>> &updates) = 0;
+    /**
+     * Deletes the rows selected by each of the predicates in one transaction, deletedRows receives the count of
+     * each item in order. Nothing is deleted if any item fails.
+     */
+    virtual int BatchDelete(std::vector<int64_t> &deletedRows, const std::vector<AbsRdbPredicates> &predicates) = 0;
 
     virtual int GetVersion(int &version) = 0;
     virtual int SetVersion(int version) = 0;
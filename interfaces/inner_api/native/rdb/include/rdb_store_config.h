@@ -58,6 +58,31 @@ enum class DatabaseFileSecurityLevel {
     NO_LEVEL,
 };
 
+// indicates who checkpoints the WAL file into the database
+enum class CheckpointPolicy {
+    AUTO,     // the write committing past the auto checkpoint size
+    PASSIVE,  // a background task, without waiting for readers or writers
+    TRUNCATE, // a background task, which also truncates the WAL file and retries later while readers use it
+};
+
+// indicates where temporary tables and indices are kept
+enum class TempStore {
+    DEFAULT,
+    FILE,
+    MEMORY,
+};
+
+// SQLite settings applied to each connection, a negative value means the default of the connection kind is used.
+// The page size, journal size limit and auto checkpoint only apply to the write connection.
+struct SqliteTuning {
+    int pageSize = -1;         // bytes, takes effect when the database is created
+    int cacheSize = -1;        // KiB of page cache
+    int64_t mmapSize = -1;     // bytes of the database file accessed through memory mapping, 0 turns it off
+    int journalSizeLimit = -1; // bytes the journal or WAL file is truncated to after a reset
+    int autoCheckpoint = -1;   // WAL pages committed before a write checkpoints, 0 turns it off
+    TempStore tempStore = TempStore::DEFAULT;
+};
+
 using DistributedType = OHOS::DistributedRdb::RdbDistributedType;
 
 class RdbStoreConfig {
@@ -102,12 +127,39 @@ public:
     void SetEncryptLevel(const std::string& secLevel);
     std::string GetEncryptLevel() const;
 
+    // performance tuning
+    int SetStatementCacheSize(int size);
+    int GetStatementCacheSize() const;
+    int SetReadConnectionRange(int minCount, int maxCount);
+    int GetMinReadConnectionCount() const;
+    int GetMaxReadConnectionCount() const;
+    int SetReadConnectionIdleTimeout(int milliseconds);
+    int GetReadConnectionIdleTimeout() const;
+    int SetConnectionAcquireTimeout(int milliseconds);
+    int GetConnectionAcquireTimeout() const;
+    int SetGroupCommitWindow(int milliseconds);
+    int GetGroupCommitWindow() const;
+    int SetCheckpointPolicy(CheckpointPolicy policy);
+    CheckpointPolicy GetCheckpointPolicy() const;
+    int SetCheckpointThreshold(int walPages, int idleMilliseconds);
+    int GetCheckpointWalPages() const;
+    int GetCheckpointIdleTime() const;
+    int SetWriteConnectionTuning(const SqliteTuning &tuning);
+    SqliteTuning GetWriteConnectionTuning() const;
+    int SetReadConnectionTuning(const SqliteTuning &tuning);
+    SqliteTuning GetReadConnectionTuning() const;
+    int SetReadConnectionMmap(bool enabled, int64_t sizeLimit = -1);
+    bool IsReadConnectionMmapEnabled() const;
+    int64_t GetReadConnectionMmapSizeLimit() const;
+
     static std::string GetJournalModeValue(JournalMode journalMode);
     static std::string GetSyncModeValue(SyncMode syncMode);
     static std::string GetDatabaseFileTypeValue(DatabaseFileType databaseFileType);
     static std::string GetDatabaseFileSecurityLevelValue(DatabaseFileSecurityLevel databaseFileSecurityLevel);
 
 private:
+    static bool IsValidTuning(const SqliteTuning &tuning);
+
     std::string name;
     std::string path;
     StorageMode storageMode;
@@ -124,6 +176,21 @@ private:
     std::string moduleName_;
     std::string relativePath_;
     std::string encryptLevel_;
+
+    // performance tuning
+    int statementCacheSize_ = -1;
+    int minReadConnectionCount_ = -1;
+    int maxReadConnectionCount_ = -1;
+    int readConnectionIdleTimeout_ = -1;
+    int connectionAcquireTimeout_ = -1;
+    int groupCommitWindow_ = 0;
+    CheckpointPolicy checkpointPolicy_ = CheckpointPolicy::AUTO;
+    int checkpointWalPages_ = -1;
+    int checkpointIdleTime_ = -1;
+    SqliteTuning writeConnectionTuning_;
+    SqliteTuning readConnectionTuning_;
+    bool readConnectionMmap_ = false;
+    int64_t readConnectionMmapSizeLimit_ = -1;
 };
 } // namespace OHOS::NativeRdb
 
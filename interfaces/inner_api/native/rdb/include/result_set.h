@@ -66,6 +66,16 @@ public:
      */
     virtual int GetColumnIndex(const std::string &columnName, int &columnIndex) = 0;
 
+    /**
+     * Returns the zero-based indexes for the given column names, so that a
+     * whole projection is resolved at once.
+     *
+     * param columnNames the names of the columns.
+     * return the column index for each given column, -1 for the columns
+     *     that do not exist.
+     */
+    virtual int GetColumnIndexes(const std::vector<std::string> &columnNames, std::vector<int> &columnIndexes) = 0;
+
     /**
      * Returns the column name at the given column index.
      *
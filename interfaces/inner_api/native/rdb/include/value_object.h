@@ -17,6 +17,7 @@
 #define NATIVE_RDB_VALUE_OBJECT_H
 
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 #include <parcel.h>
@@ -55,6 +56,8 @@ public:
     int GetBool(bool &val) const;
     int GetString(std::string &val) const;
     int GetBlob(std::vector<uint8_t> &val) const;
+    int GetStringView(std::string_view &val) const;
+    int GetBlobView(const uint8_t *&data, size_t &size) const;
 
     bool Marshalling(Parcel &parcel) const override;
     static ValueObject *Unmarshalling(Parcel &parcel);
@@ -16,8 +16,12 @@
 #ifndef NATIVE_RDB_VALUES_BUCKET_H
 #define NATIVE_RDB_VALUES_BUCKET_H
 
+#include <functional>
 #include <map>
 #include <set>
+#include <string>
+#include <utility>
+#include <vector>
 #include <parcel.h>
 
 #include "value_object.h"
@@ -44,11 +48,19 @@ public:
     bool HasColumn(const std::string &columnName) const;
     bool GetObject(const std::string &columnName, ValueObject &value) const;
     void GetAll(std::map<std::string, ValueObject> &valuesMap) const;
+    // visits the columns in ascending order of their names without copying them
+    void ForEach(const std::function<void(const std::string &, const ValueObject &)> &visitor) const;
 
     bool Marshalling(Parcel &parcel) const override;
     static ValuesBucket *Unmarshalling(Parcel &parcel);
 private:
-    std::map<std::string, ValueObject> valuesMap;
+    using Column = std::pair<std::string, ValueObject>;
+    void Put(const std::string &columnName, ValueObject &&value);
+    std::vector<Column>::const_iterator Find(const std::string &columnName) const;
+
+    // sorted by column name, short names stay in the inline buffer of std::string
+    std::vector<Column> columns;
+    static constexpr size_t DEFAULT_CAPACITY = 8;
 };
 
 } // namespace NativeRdb